@@ -1843,6 +1843,14 @@ SOURCE=.\src\sat\bsat\satProof2.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bsat\satShare.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\bsat\satShare.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bsat\satSolver.c
 # End Source File
 # Begin Source File
@@ -4003,6 +4011,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -4739,6 +4755,10 @@ SOURCE=.\src\aig\gia\giaAigerExt.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaArena.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaBalAig.c
 # End Source File
 # Begin Source File
@@ -4919,6 +4939,10 @@ SOURCE=.\src\aig\gia\giaMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaMapPart.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaMem.c
 # End Source File
 # Begin Source File
@@ -5391,6 +5415,10 @@ SOURCE=.\src\proof\cec\cecPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecProve.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSat.c
 # End Source File
 # Begin Source File
@@ -5739,6 +5767,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -1160,7 +1160,9 @@ void Aig_ManRandomTest1()
 
   Synopsis    [Creates a sequence of random numbers.]
 
-  Description []
+  Description [Each thread has its own sequence, so that engines running
+  in parallel (for example, the partitions of scorr -T) do not race on
+  the state and get the same numbers as when they run alone.]
                
   SideEffects []
 
@@ -1169,8 +1171,8 @@ void Aig_ManRandomTest1()
 ***********************************************************************/
 unsigned Aig_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
@@ -1566,6 +1568,40 @@ void Aig_ManInvertConstraints( Aig_Man_t * pAig )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural hash of the AIG.]
+
+  Description [The hash depends on the numbers of objects of each type
+  and on the fanins of the internal nodes and combinational outputs,
+  given by the order of the objects rather than by their IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Aig_ManStructHash( Aig_Man_t * p )
+{
+    Vec_Int_t * vOrder;
+    Aig_Obj_t * pObj;
+    unsigned Hash;
+    int i, nObjs = 0;
+    Hash = (unsigned)(Aig_ManCiNum(p) * 7937 + Aig_ManCoNum(p) * 2971 + Aig_ManRegNum(p) * 911 + Aig_ManNodeNum(p));
+    vOrder = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        Vec_IntWriteEntry( vOrder, pObj->Id, nObjs++ );
+        if ( Aig_ObjIsConst1(pObj) || Aig_ObjIsCi(pObj) )
+            continue;
+        Hash = Hash * 0x9E3779B1 + (unsigned)Abc_Var2Lit( Vec_IntEntry(vOrder, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj) );
+        if ( Aig_ObjIsNode(pObj) )
+            Hash = Hash * 0x9E3779B1 + (unsigned)Abc_Var2Lit( Vec_IntEntry(vOrder, Aig_ObjFaninId1(pObj)), Aig_ObjFaninC1(pObj) );
+    }
+    Vec_IntFree( vOrder );
+    return Hash;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
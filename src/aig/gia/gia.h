@@ -34,6 +34,7 @@
 #include "misc/vec/vec.h"
 #include "misc/vec/vecWec.h"
 #include "misc/util/utilCex.h"
+#include "misc/util/utilSimd.h"
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -42,8 +43,19 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// wide-object mode (compile with -DABC_USE_WIDE_GIA) uses 16-byte objects
+// with 31-bit fanin diffs; the object count is then limited only by the 
+// 32-bit literal encoding used throughout ABC (2^30 objects)
+#ifdef ABC_USE_WIDE_GIA
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_VOID 0x7FFFFFFF
+#define GIA_OBJ_LIMIT_LOG 30
+#else
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_OBJ_LIMIT_LOG 29
+#endif
+#define GIA_OBJ_LIMIT (1 << GIA_OBJ_LIMIT_LOG)
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -56,7 +68,11 @@ typedef struct Gia_MmStep_t_         Gia_MmStep_t;
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iRepr   : 31;  // representative node
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -75,6 +91,21 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused:  28;  // padding
+
+    unsigned       Value;         // application-specific value
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -86,6 +117,7 @@ struct Gia_Obj_t_
     unsigned       fPhase :   1;  // value under 000 pattern
 
     unsigned       Value;         // application-specific value
+#endif
 };
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
@@ -108,8 +140,10 @@ struct Gia_Man_t_
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
-    Vec_Int_t      vHTable;       // hash table
+    Vec_Int_t      vHash;         // hash table being migrated
+    Vec_Int_t      vHTable;       // hash table (open addressing)
+    int            nHashEntries;  // the number of hashed nodes
+    int            iHashMove;     // the next slot of the old table to migrate
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -247,6 +281,7 @@ struct Gps_Par_t_
     int            fSkipMap;
     int            fSlacks;
     int            fNoColor;
+    int            fArena;
     char *         pDumpFile;
 };
 
@@ -632,18 +667,19 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void * Gia_ArenaRealloc( void * pBlock, size_t nBytesOld, size_t nBytes );
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew = p->nObjsAlloc < GIA_OBJ_LIMIT / 2 ? 2 * p->nObjsAlloc : GIA_OBJ_LIMIT;
+        if ( p->nObjs == GIA_OBJ_LIMIT )
+            printf( "Hard limit on the number of nodes (2^%d) is reached. Quitting...\n", GIA_OBJ_LIMIT_LOG ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
-        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
+        p->pObjs = (Gia_Obj_t *)Gia_ArenaRealloc( p->pObjs, sizeof(Gia_Obj_t) * p->nObjsAlloc, sizeof(Gia_Obj_t) * nObjNew );
         memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
         if ( p->pMuxes )
         {
@@ -652,7 +688,6 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -1207,14 +1242,22 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 ////////////////////////////////////////////////////////////////////////
 
 /*=== giaAiger.c ===========================================================*/
-extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern size_t              Gia_FileSize( char * pFileName );
+extern char *              Gia_FileMap( char * pFileName, size_t * pnFileSize, int * pfMapped );
+extern void                Gia_FileUnmap( char * pContents, size_t nFileSize, int fMapped );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
 extern void                Gia_AigerWriteSimple( Gia_Man_t * pInit, char * pFileName );
+/*=== giaArena.c ===========================================================*/
+extern void *              Gia_ArenaAlloc( size_t nBytes );
+extern void                Gia_ArenaFree( void * pBlock, size_t nBytes );
+extern void                Gia_ArenaStop();
+extern void                Gia_ArenaSetEnabled( int fEnable );
+extern void                Gia_ArenaPrint();
 /*=== giaBalance.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose );
 extern Gia_Man_t *         Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose );
@@ -1477,6 +1520,8 @@ extern void                Gia_ManSetRegNum( Gia_Man_t * p, int nRegs );
 extern void                Gia_ManReportImprovement( Gia_Man_t * p, Gia_Man_t * pNew );
 extern void                Gia_ManPrintNpnClasses( Gia_Man_t * p );
 extern void                Gia_ManDumpVerilog( Gia_Man_t * p, char * pFileName, Vec_Int_t * vObjs );
+/*=== giaMapPart.c ===========================================================*/
+extern Gia_Man_t *         Gia_ManPerformMappingPart( Gia_Man_t * p, Jf_Par_t * pPars, Gia_Man_t * (* pFuncMap)( Gia_Man_t *, Jf_Par_t * ) );
 /*=== giaMem.c ===========================================================*/
 extern Gia_MmFixed_t *     Gia_MmFixedStart( int nEntrySize, int nEntriesMax );
 extern void                Gia_MmFixedStop( Gia_MmFixed_t * p, int fVerbose );
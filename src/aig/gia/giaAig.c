@@ -542,7 +542,8 @@ void Gia_ManReprFromAigRepr2( Aig_Man_t * pAig, Gia_Man_t * pGia )
 
   Synopsis    [Applies DC2 to the GIA manager.]
 
-  Description []
+  Description [The multithreaded version evaluates the cuts during
+  rewriting on nThreads threads (0 = serial).]
                
   SideEffects []
 
@@ -550,13 +551,17 @@ void Gia_ManReprFromAigRepr2( Aig_Man_t * pAig, Gia_Man_t * pGia )
 
 ***********************************************************************/
 Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+{
+    return Gia_ManCompress2Mt( p, fUpdateLevel, 0, fVerbose );
+}
+Gia_Man_t * Gia_ManCompress2Mt( Gia_Man_t * p, int fUpdateLevel, int nThreads, int fVerbose )
 {
     Gia_Man_t * pGia;
     Aig_Man_t * pNew, * pTemp;
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     pNew = Gia_ManToAig( p, 0 );
-    pNew = Dar_ManCompress2( pTemp = pNew, 1, fUpdateLevel, 1, 0, fVerbose );
+    pNew = Dar_ManCompress2Mt( pTemp = pNew, 1, fUpdateLevel, 1, 0, nThreads, fVerbose );
     Aig_ManStop( pTemp );
     pGia = Gia_ManFromAig( pNew );
     Aig_ManStop( pNew );
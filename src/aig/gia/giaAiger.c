@@ -23,6 +23,14 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GIA_USE_MMAP
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -61,10 +69,10 @@ char * Gia_FileNameGeneric( char * FileName )
         *pDot = 0;
     return pRes;
 }
-int Gia_FileSize( char * pFileName )
+size_t Gia_FileSize( char * pFileName )
 {
     FILE * pFile;
-    int nFileSize;
+    size_t nFileSize;
     pFile = fopen( pFileName, "r" );
     if ( pFile == NULL )
     {
@@ -76,6 +84,86 @@ int Gia_FileSize( char * pFileName )
     fclose( pFile );
     return nFileSize;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the file contents available in memory.]
+
+  Description [Where possible, the file is memory-mapped (privately, 
+  so that the reader can modify the buffer), which avoids copying it 
+  into the heap. Otherwise, the file is read into a heap buffer. 
+  The flag fMapped tells Gia_FileUnmap() how to release the buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, size_t * pnFileSize, int * pfMapped )
+{
+    FILE * pFile;
+    char * pContents;
+    size_t nFileSize;
+    *pnFileSize = 0;
+    *pfMapped = 0;
+#ifdef GIA_USE_MMAP
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd == -1 )
+        {
+            printf( "Gia_FileMap(): The file is unavailable (absent or open).\n" );
+            return NULL;
+        }
+        if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+            if ( pContents != (char *)MAP_FAILED )
+            {
+                close( fd );
+#ifdef MADV_SEQUENTIAL
+                madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+                *pnFileSize = (size_t)Stat.st_size;
+                *pfMapped = 1;
+                return pContents;
+            }
+        }
+        close( fd );
+    }
+#endif
+    // fall back to reading the file into the heap
+    nFileSize = Gia_FileSize( pFileName );
+    if ( nFileSize == 0 )
+        return NULL;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nFileSize );
+    if ( fread( pContents, nFileSize, 1, pFile ) != 1 )
+    {
+        printf( "Gia_FileMap(): Cannot read file \"%s\".\n", pFileName );
+        ABC_FREE( pContents );
+        fclose( pFile );
+        return NULL;
+    }
+    fclose( pFile );
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+void Gia_FileUnmap( char * pContents, size_t nFileSize, int fMapped )
+{
+#ifdef GIA_USE_MMAP
+    if ( fMapped )
+    {
+        munmap( pContents, nFileSize );
+        return;
+    }
+#endif
+    assert( !fMapped );
+    ABC_FREE( pContents );
+}
+
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
     unsigned char Buffer[5];
@@ -173,7 +261,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
@@ -252,6 +340,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
     }
 
+    if ( (word)nTotal + nLatches + nOutputs + 1 > (word)GIA_OBJ_LIMIT )
+    {
+        fprintf( stdout, "The number of objects exceeds the limit (2^%d) of this build.\n", GIA_OBJ_LIMIT_LOG );
+        return NULL;
+    }
+
     // allocate the empty AIG
     pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
     pNew->nConstrs = nConstr;
@@ -523,12 +617,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             // read extra AIG
             if ( *pCur == 'a' )
             {
+                int nSize;
                 pCur++;
-                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );             pCur += 4;
-                memcpy( Vec_StrArray(vStr), pCur, (size_t)Vec_StrSize(vStr) );
-                pCur += Vec_StrSize(vStr);
-                pNew->pAigExtra = Gia_AigerReadFromMemory( Vec_StrArray(vStr), Vec_StrSize(vStr), 0, 0, 0 );
-                Vec_StrFree( vStr );
+                nSize = Gia_AigerReadInt(pCur);                            pCur += 4;
+                // the buffer is not needed after reading, so the extra AIG is decoded in place
+                pNew->pAigExtra = Gia_AigerReadFromMemory( (char *)pCur, nSize, 0, 0, 0 );
+                pCur += nSize;
                 if ( fVerbose ) printf( "Finished reading extension \"a\".\n" );
             }
             // read number of constraints
@@ -882,22 +976,19 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
-    FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize;
+    int fMapped;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    pContents = Gia_FileMap( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+        return NULL;
 
     pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    Gia_FileUnmap( pContents, nFileSize, fMapped );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1155,9 +1246,9 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
+    // write the nodes into the buffer, which is flushed when full
     Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+    nBufferSize = Abc_MinInt( Gia_ManAndNum(p), (1 << 24) ) * 8 + 100; // skeptically assuming 3 chars per one AIG edge
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1167,13 +1258,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
         Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
         Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        if ( Pos > nBufferSize - 20 )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            fwrite( pBuffer, 1, Pos, pFile );
+            Pos = 0;
         }
     }
     assert( Pos < nBufferSize );
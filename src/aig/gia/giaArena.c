@@ -0,0 +1,322 @@
+/**CFile****************************************************************
+
+  FileName    [giaArena.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Recycling of large manager arrays across commands.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaArena.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Almost every command builds a new manager and then frees the old one.
+// The large arrays of a freed manager (the object array and the hash
+// table) are kept here and handed to the next manager, so that a script
+// reuses the same memory instead of returning it to the system and
+// faulting it in again at the next step. Blocks are ordinary heap
+// blocks, so freeing them with ABC_FREE() is still correct.
+// The arena never keeps more memory than is used by the live blocks,
+// so everything is released when the last manager is freed.
+// It is turned off by "set gianoarena" and on again by "unset gianoarena".
+
+#define GIA_ARENA_MIN    (1 << 20)    // the smallest block worth keeping (bytes)
+#define GIA_ARENA_MAX    8            // the largest number of kept blocks
+
+typedef struct Gia_Arena_t_ Gia_Arena_t;
+struct Gia_Arena_t_
+{
+    void *         pBlocks[GIA_ARENA_MAX]; // kept blocks
+    size_t         nBytes[GIA_ARENA_MAX];  // their sizes
+    int            nBlocks;                // the number of kept blocks
+    int            fDisabled;              // blocks are allocated and freed directly
+    size_t         nBytesLive;             // the total size of large blocks in use
+    size_t         nBytesKept;             // the total size of kept blocks
+    size_t         nBytesPeak;             // the peak size of kept blocks
+    word           nRequests;              // large requests
+    word           nReused;                // large requests served from kept blocks
+    word           nBytesReused;           // the total size of reused blocks
+};
+
+static Gia_Arena_t s_GiaArena;
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_GiaArenaMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Gia_ArenaLock()   { pthread_mutex_lock( &s_GiaArenaMutex );   }
+static inline void Gia_ArenaUnlock() { pthread_mutex_unlock( &s_GiaArenaMutex ); }
+#else
+static inline void Gia_ArenaLock()   {}
+static inline void Gia_ArenaUnlock() {}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the smallest kept block that fits the request.]
+
+  Description [Blocks more than twice as large as the request are not
+  used, to avoid pinning a lot of memory under a small manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_ArenaTake( size_t nBytes )
+{
+    Gia_Arena_t * p = &s_GiaArena;
+    void * pBlock = NULL;
+    int i, iBest = -1;
+    Gia_ArenaLock();
+    p->nRequests++;
+    p->nBytesLive += nBytes;
+    for ( i = 0; i < p->nBlocks && !p->fDisabled; i++ )
+        if ( p->nBytes[i] >= nBytes && p->nBytes[i] <= 2 * nBytes && (iBest == -1 || p->nBytes[i] < p->nBytes[iBest]) )
+            iBest = i;
+    if ( iBest >= 0 )
+    {
+        pBlock = p->pBlocks[iBest];
+        p->nBytesKept -= p->nBytes[iBest];
+        p->nBytesReused += p->nBytes[iBest];
+        p->nReused++;
+        p->nBlocks--;
+        p->pBlocks[iBest] = p->pBlocks[p->nBlocks];
+        p->nBytes[iBest]  = p->nBytes[p->nBlocks];
+    }
+    Gia_ArenaUnlock();
+    return pBlock;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates a zeroed block.]
+
+  Description [A reused block may be larger than requested, but only
+  the requested size is used and later passed to Gia_ArenaFree().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ArenaAlloc( size_t nBytes )
+{
+    void * pBlock = nBytes >= GIA_ARENA_MIN ? Gia_ArenaTake( nBytes ) : NULL;
+    if ( pBlock )
+    {
+        memset( pBlock, 0, nBytes );
+        return pBlock;
+    }
+    return ABC_CALLOC( char, nBytes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Grows the block while keeping its contents.]
+
+  Description [The memory beyond the old size is not initialized.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ArenaRealloc( void * pBlock, size_t nBytesOld, size_t nBytes )
+{
+    void * pNew = nBytes >= GIA_ARENA_MIN ? Gia_ArenaTake( nBytes ) : NULL;
+    assert( nBytesOld <= nBytes );
+    if ( pNew )
+    {
+        memcpy( pNew, pBlock, nBytesOld );
+        Gia_ArenaFree( pBlock, nBytesOld );
+        return pNew;
+    }
+    if ( nBytesOld >= GIA_ARENA_MIN )
+    {
+        Gia_ArenaLock();
+        s_GiaArena.nBytesLive -= nBytesOld;
+        Gia_ArenaUnlock();
+    }
+    return ABC_REALLOC( char, pBlock, nBytes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the smallest kept block.]
+
+  Description [Should be called with the lock held.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ArenaSmallest( Gia_Arena_t * p )
+{
+    int i, iMin = 0;
+    assert( p->nBlocks > 0 );
+    for ( i = 1; i < p->nBlocks; i++ )
+        if ( p->nBytes[i] < p->nBytes[iMin] )
+            iMin = i;
+    return iMin;
+}
+static void Gia_ArenaDropSmallest( Gia_Arena_t * p )
+{
+    int iMin = Gia_ArenaSmallest( p );
+    ABC_FREE( p->pBlocks[iMin] );
+    p->nBytesKept -= p->nBytes[iMin];
+    p->nBlocks--;
+    p->pBlocks[iMin] = p->pBlocks[p->nBlocks];
+    p->nBytes[iMin]  = p->nBytes[p->nBlocks];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the block to the arena.]
+
+  Description [The block is kept only if it is not smaller than the kept
+  blocks released to make room for it. Afterwards, the smallest blocks 
+  are released until the arena keeps no more than the size of the blocks
+  still in use; in particular, all of them are released when the last 
+  manager is freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ArenaFree( void * pBlock, size_t nBytes )
+{
+    Gia_Arena_t * p = &s_GiaArena;
+    if ( pBlock == NULL )
+        return;
+    if ( nBytes < GIA_ARENA_MIN )
+    {
+        ABC_FREE( pBlock );
+        return;
+    }
+    Gia_ArenaLock();
+    assert( p->nBytesLive >= nBytes );
+    p->nBytesLive -= nBytes;
+    if ( !p->fDisabled && nBytes <= p->nBytesLive )
+    {
+        // make room by releasing smaller blocks
+        while ( p->nBlocks > 0 && (p->nBlocks == GIA_ARENA_MAX || p->nBytesKept + nBytes > p->nBytesLive) )
+        {
+            if ( p->nBytes[Gia_ArenaSmallest(p)] >= nBytes )
+                break;
+            Gia_ArenaDropSmallest( p );
+        }
+        if ( p->nBlocks < GIA_ARENA_MAX && p->nBytesKept + nBytes <= p->nBytesLive )
+        {
+            p->pBlocks[p->nBlocks] = pBlock;
+            p->nBytes[p->nBlocks]  = nBytes;
+            p->nBlocks++;
+            p->nBytesKept += nBytes;
+            p->nBytesPeak = Abc_MaxWord( p->nBytesPeak, p->nBytesKept );
+            pBlock = NULL;
+        }
+    }
+    while ( p->nBytesKept > p->nBytesLive )
+        Gia_ArenaDropSmallest( p );
+    Gia_ArenaUnlock();
+    ABC_FREE( pBlock );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the kept blocks.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ArenaStop()
+{
+    Gia_Arena_t * p = &s_GiaArena;
+    Gia_ArenaLock();
+    while ( p->nBlocks > 0 )
+        Gia_ArenaDropSmallest( p );
+    Gia_ArenaUnlock();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Turns the arena on or off.]
+
+  Description [When the arena is off, large blocks are allocated and 
+  freed directly, as all other blocks are.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ArenaSetEnabled( int fEnable )
+{
+    Gia_ArenaLock();
+    s_GiaArena.fDisabled = !fEnable;
+    Gia_ArenaUnlock();
+    if ( !fEnable )
+        Gia_ArenaStop();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the arena statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ArenaPrint()
+{
+    Gia_Arena_t * p = &s_GiaArena;
+    Gia_ArenaLock();
+    Abc_Print( 1, "Arena:  kept = %d blocks (%.2f MB)  peak = %.2f MB  ", p->nBlocks, 1.0*p->nBytesKept/(1<<20), 1.0*p->nBytesPeak/(1<<20) );
+    Abc_Print( 1, "reused = %d of %d requests (%.2f MB)\n", (int)p->nReused, (int)p->nRequests, 1.0*p->nBytesReused/(1<<20) );
+    Gia_ArenaUnlock();
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -20,6 +20,11 @@
 
 #include "gia.h"
 
+#if !defined(ABC_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define GIA_HASH_SSE2
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,44 +32,176 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_HASH_SLOT   3           // the number of entries in one slot (iLit0, iLit1, iObj)
+#define GIA_HASH_MOVE   8           // the number of old slots moved after each insertion
+#define GIA_HASH_MAX    0x2AAAAAA8  // the largest number of slots (3 * GIA_HASH_MAX + 1 fits into int)
+
+void Gia_ManHashResize( Gia_Man_t * p );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    [Returns the place where this node is stored (or should be stored).]
+  Synopsis    [Returns the home slot of the node in the table.]
 
-  Description []
+  Description [The table uses open addressing with linear probing.
+  Each slot keeps the fanin literals and the node ID inline, so that
+  most lookups touch one cache line and never dereference the nodes.
+  The control literal of a MUX is not stored but it is hashed and
+  compared through the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashSlotNum( Vec_Int_t * vTable ) 
+{
+    return Vec_IntSize(vTable) ? (Vec_IntSize(vTable) - 1) / GIA_HASH_SLOT : 0;
+}
+static inline void Gia_ManHashTableAlloc( Vec_Int_t * vTable, int nSlots ) 
+{
+    assert( vTable->pArray == NULL );
+    vTable->nSize  = GIA_HASH_SLOT * nSlots + 1;
+    vTable->nCap   = vTable->nSize;
+    vTable->pArray = (int *)Gia_ArenaAlloc( sizeof(int) * vTable->nSize );
+}
+static inline void Gia_ManHashTableFree( Vec_Int_t * vTable ) 
+{
+    Gia_ArenaFree( vTable->pArray, sizeof(int) * vTable->nCap );
+    Vec_IntZero( vTable );
+}
+static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int nSlots ) 
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1;
+    Key += (unsigned)iLit1 * 0x85EBCA77;
+    Key += (unsigned)iLitC * 0xC2B2AE3D;
+    Key ^= Key >> 16;
+    Key *= 0x85EBCA6B;
+    return (int)(((word)Key * (word)nSlots) >> 32);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the slot where this node is stored (or should be stored).]
+
+  Description [The returned slot is either empty (pSlot[2] == 0) or
+  holds the node with these fanins.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+static inline int * Gia_ManHashProbe( Gia_Man_t * p, Vec_Int_t * vTable, int iLit0, int iLit1, int iLitC )
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    int nSlots = Gia_ManHashSlotNum( vTable );
+    int i = Gia_ManHashOne( iLit0, iLit1, iLitC, nSlots );
+    int * pSlot = Vec_IntArray(vTable) + GIA_HASH_SLOT * i;
+#ifdef GIA_HASH_SSE2
+    // compares both literals and checks the node ID for zero in one step;
+    // the table is padded by one entry, so loading four words is safe
+    __m128i Key = _mm_setr_epi32( iLit0, iLit1, 0, 0 );
+    while ( 1 )
+    {
+        int Mask = _mm_movemask_epi8( _mm_cmpeq_epi32(_mm_loadu_si128((__m128i *)pSlot), Key) ) & 0xFFF;
+        if ( Mask & 0xF00 )
+            return pSlot;
+        if ( Mask == 0xFF && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, pSlot[2]) == iLitC) )
+            return pSlot;
+        if ( ++i == nSlots )
+            i = 0, pSlot = Vec_IntArray(vTable);
+        else
+            pSlot += GIA_HASH_SLOT;
+    }
+#else
+    while ( 1 )
+    {
+        if ( pSlot[2] == 0 )
+            return pSlot;
+        if ( pSlot[0] == iLit0 && pSlot[1] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, pSlot[2]) == iLitC) )
+            return pSlot;
+        if ( ++i == nSlots )
+            i = 0, pSlot = Vec_IntArray(vTable);
+        else
+            pSlot += GIA_HASH_SLOT;
+    }
+#endif
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    int * pSlot = Gia_ManHashProbe( p, &p->vHTable, iLit0, iLit1, iLitC );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    // the nodes not yet moved from the old table are still found there
+    if ( pSlot[2] == 0 && Vec_IntSize(&p->vHash) )
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-            break;
+        int * pSlotOld = Gia_ManHashProbe( p, &p->vHash, iLit0, iLit1, iLitC );
+        if ( pSlotOld[2] )
+            return pSlotOld;
     }
-    return pPlace;
+    return pSlot;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves a few slots of the old table into the new one.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManHashMigrate( Gia_Man_t * p, int nSlots )
+{
+    int nSlotsOld = Gia_ManHashSlotNum( &p->vHash );
+    int iStop = Abc_MinInt( p->iHashMove + nSlots, nSlotsOld );
+    int * pOld, * pSlot;
+    for ( ; p->iHashMove < iStop; p->iHashMove++ )
+    {
+        pOld = Vec_IntEntryP( &p->vHash, GIA_HASH_SLOT * p->iHashMove );
+        if ( pOld[2] == 0 )
+            continue;
+        pSlot = Gia_ManHashProbe( p, &p->vHTable, pOld[0], pOld[1], Gia_ObjFaninLit2(p, pOld[2]) );
+        assert( pSlot[2] == 0 ); // should not be there
+        pSlot[0] = pOld[0];
+        pSlot[1] = pOld[1];
+        pSlot[2] = pOld[2];
+    }
+    if ( p->iHashMove == nSlotsOld )
+    {
+        Gia_ManHashTableFree( &p->vHash );
+        p->iHashMove = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the node to the empty slot returned by Gia_ManHashFind().]
+
+  Description [Returns the node ID.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashInsert( Gia_Man_t * p, int * pSlot, int iLit0, int iLit1, int iObj )
+{
+    assert( pSlot[2] == 0 && iObj > 0 );
+    pSlot[0] = iLit0;
+    pSlot[1] = iLit1;
+    pSlot[2] = iObj;
+    if ( Vec_IntSize(&p->vHash) )
+        Gia_ManHashMigrate( p, GIA_HASH_MOVE );
+    if ( ++p->nHashEntries > Gia_ManHashSlotNum(&p->vHTable) / 3 * 2 )
+        Gia_ManHashResize( p );
+    return iObj;
 }
 
 /**Function*************************************************************
@@ -82,7 +219,7 @@ int Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 )
 {
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
-    return Abc_Var2Lit( *Gia_ManHashFind( p, iLit0, iLit1, -1 ), 0 );
+    return Abc_Var2Lit( Gia_ManHashFind( p, iLit0, iLit1, -1 )[2], 0 );
 }
 int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 {
@@ -95,7 +232,10 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 
   Synopsis    [Starts the hash table.]
 
-  Description []
+  Description [The table is sized to hold the expected number of nodes
+  at two-thirds load; it grows incrementally afterwards. The memory is
+  taken from the arena, so it is usually recycled from the table of
+  the previous manager.]
                
   SideEffects []
 
@@ -104,11 +244,14 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nEntries = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
+    int nSlots = Abc_MinInt( Abc_MaxInt(nEntries, 1000) / 2 * 3, GIA_HASH_MAX );
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    Gia_ManHashTableFree( &p->vHash );
+    Gia_ManHashTableAlloc( &p->vHTable, nSlots );
+    p->nHashEntries = 0;
+    p->iHashMove = 0;
+//printf( "Alloced table with %d entries.\n", nSlots );
 }
 
 /**Function*************************************************************
@@ -125,13 +268,13 @@ void Gia_ManHashAlloc( Gia_Man_t * p )
 void Gia_ManHashStart( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int * pPlace, i;
+    int * pSlot, i;
     Gia_ManHashAlloc( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
-        pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
-        assert( *pPlace == 0 );
-        *pPlace = i;
+        pSlot = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
+        assert( pSlot[2] == 0 );
+        Gia_ManHashInsert( p, pSlot, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), i );
     }
 }
 
@@ -148,15 +291,24 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    Gia_ManHashTableFree( &p->vHTable );
+    Gia_ManHashTableFree( &p->vHash );
+    p->nHashEntries = 0;
+    p->iHashMove = 0;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [Allocates a table twice as large and keeps the current 
+  one as the old table. The nodes are moved from the old table a few
+  slots at a time by the following insertions, so the cost of rehashing
+  is spread over the construction instead of stalling it. The table 
+  cannot grow beyond GIA_HASH_MAX slots; this is reached only in the 
+  wide-object mode, and the run stops when the table is nearly full, 
+  because linear probing would otherwise degrade and, on a full table, 
+  never terminate.]
                
   SideEffects []
 
@@ -165,32 +317,25 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
-    // replace the table
+    int nSlots = Gia_ManHashSlotNum( &p->vHTable );
+    int nSlotsNew = Abc_MinInt( 2 * nSlots, GIA_HASH_MAX );
+    assert( nSlots > 0 );
+    if ( nSlotsNew == nSlots )
+    {
+        if ( p->nHashEntries > nSlots / 8 * 7 )
+            printf( "Hard limit on the number of hashed nodes (%d) is reached. Quitting...\n", nSlots / 8 * 7 ), exit(1);
+        return;
+    }
+    // finish the previous migration
+    if ( Vec_IntSize(&p->vHash) )
+        Gia_ManHashMigrate( p, Gia_ManHashSlotNum(&p->vHash) );
+    // the current table becomes the old one
+    p->vHash = p->vHTable;
     Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
+    Gia_ManHashTableAlloc( &p->vHTable, nSlotsNew );
+    p->iHashMove = 0;
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", nSlots, nSlotsNew );
 }
 
 /**Function********************************************************************
@@ -206,22 +351,23 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
+    int nSlots = Gia_ManHashSlotNum( &p->vHTable );
+    int i, iHome, Dist, DistMax = 0;
+    word DistTotal = 0;
+    printf( "Table size = %d. Entries = %d. ", nSlots, p->nHashEntries );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    for ( i = 0; i < nSlots; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        int * pSlot = Vec_IntEntryP( &p->vHTable, GIA_HASH_SLOT * i );
+        if ( pSlot[2] == 0 )
+            continue;
+        iHome = Gia_ManHashOne( pSlot[0], pSlot[1], Gia_ObjFaninLit2(p, pSlot[2]), nSlots );
+        Dist  = i >= iHome ? i - iHome : i + nSlots - iHome;
+        DistTotal += Dist;
+        DistMax = Abc_MaxInt( DistMax, Dist );
     }
-    printf( "\n" );
+    printf( "Probe length: average = %.2f. max = %d. ", p->nHashEntries ? 1.0 + (double)DistTotal / p->nHashEntries : 0.0, 1 + DistMax );
+    printf( "Old table = %d slots.\n", Gia_ManHashSlotNum(&p->vHash) );
 }
 
 /**Function*************************************************************
@@ -478,8 +624,6 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -487,23 +631,14 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( Abc_LitIsCompl(iLit1) )
         iLit1 = Abc_LitNot(iLit1), fCompl ^= 1;
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        int * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Abc_Var2Lit( pSlot[2], fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        return Abc_Var2Lit( Gia_ManHashInsert( p, pSlot, iLit0, iLit1, Abc_Lit2Var(Gia_ManAppendXorReal(p, iLit0, iLit1)) ), fCompl );
     }
 }
 
@@ -542,23 +677,14 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-        if ( *pPlace )
+        int * pSlot = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Abc_Var2Lit( pSlot[2], fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        return Abc_Var2Lit( Gia_ManHashInsert( p, pSlot, iLit0, iLit1, Abc_Lit2Var(Gia_ManAppendMuxReal(p, iLitC, iLit1, iLit0)) ), fCompl );
     }
 }
 
@@ -588,8 +714,6 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -599,23 +723,14 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        int * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, 0 );
+            return Abc_Var2Lit( pSlot[2], 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, 0 );
+        return Abc_Var2Lit( Gia_ManHashInsert( p, pSlot, iLit0, iLit1, Abc_Lit2Var(Gia_ManAppendAnd(p, iLit0, iLit1)) ), 0 );
     }
 }
 int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )  
@@ -647,9 +762,9 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace ) 
-            return Abc_Var2Lit( *pPlace, 0 );
+        int * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] ) 
+            return Abc_Var2Lit( pSlot[2], 0 );
         return -1;
     }
 }
@@ -2242,6 +2242,9 @@ Gia_Man_t * Lf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
 Gia_Man_t * Lf_ManPerformMapping( Gia_Man_t * p, Jf_Par_t * pPars )
 {
     Gia_Man_t * pNew;
+    if ( pPars->nProcNum > 1 && !pPars->fCutMin && !pPars->fUseMux7 && !pPars->nLutSizeMux && !pPars->fPower && !pPars->fCutGroup && 
+         !Gia_ManHasChoices(p) && p->pMuxes == NULL && p->pManTime == NULL && !Gia_ManBufNum(p) )
+        return Gia_ManPerformMappingPart( p, pPars, Lf_ManPerformMapping );
     if ( p->pManTime && Tim_ManBoxNum((Tim_Man_t*)p->pManTime) && Gia_ManIsNormalized(p) )
     {
         Tim_Man_t * pTimOld = (Tim_Man_t *)p->pManTime;
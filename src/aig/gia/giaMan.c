@@ -60,7 +60,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     assert( nObjsMax > 0 );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    p->pObjs = (Gia_Obj_t *)Gia_ArenaAlloc( sizeof(Gia_Obj_t) * nObjsMax );
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -146,8 +146,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    Gia_ManHashStop( p );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
     ABC_FREE( p->pTravIds );
@@ -165,7 +164,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    Gia_ArenaFree( p->pObjs, sizeof(Gia_Obj_t) * p->nObjsAlloc );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -189,6 +188,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
     Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * Vec_IntSize(&p->vHash);
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
@@ -625,6 +625,8 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
     }
     if ( pPars && pPars->fSlacks )
         Gia_ManDfsSlacksPrint( p );
+    if ( pPars && pPars->fArena )
+        Gia_ArenaPrint();
 }
 
 /**Function*************************************************************
@@ -0,0 +1,422 @@
+/**CFile****************************************************************
+
+  FileName    [giaMapPart.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent LUT mapping of output-cone partitions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaMapPart.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The AIG is divided into partitions, each owning a set of AND nodes.
+// The COs are taken in the order of weakly connected clusters (COs whose
+// cones share AND nodes), and each CO's cone is claimed by the current
+// partition, except for the nodes already owned by an earlier one. This
+// way, the clusters are split only when they do not fit into one
+// partition. A node owned by one partition and used by another one is a
+// boundary node: it becomes a CO of the owner's subject graph and a CI of
+// the user's, so that it is always a LUT root in the final mapping and
+// its references are counted in both places.
+
+#define GIA_MAP_PART_MAX   64
+
+typedef struct Gia_MapPart_t_ Gia_MapPart_t;
+struct Gia_MapPart_t_
+{
+    Gia_Man_t *    pSub;           // subject graph of the partition
+    Vec_Int_t *    vSub2Obj;       // maps its objects into the original ones
+    Jf_Par_t       Pars;           // private copy of the parameters
+    Gia_Man_t * (* pFuncMap)( Gia_Man_t *, Jf_Par_t * ); // mapper
+    Gia_Man_t *    pRes;           // mapped subject graph
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Union-find helpers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManMapPartFind( int * pParents, int i )
+{
+    int iRoot = i, iNext;
+    while ( pParents[iRoot] != iRoot )
+        iRoot = pParents[iRoot];
+    for ( ; i != iRoot; i = iNext )
+        iNext = pParents[i], pParents[i] = iRoot;
+    return iRoot;
+}
+static inline void Gia_ManMapPartUnion( int * pParents, int i, int k )
+{
+    i = Gia_ManMapPartFind( pParents, i );
+    k = Gia_ManMapPartFind( pParents, k );
+    if ( i != k )
+        pParents[Abc_MaxInt(i, k)] = Abc_MinInt(i, k);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orders the COs by their weakly connected clusters.]
+
+  Description [Clusters are ordered by their first CO, COs of a cluster
+  are ordered by their index. Returns the CO indexes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManMapPartOrderCos( Gia_Man_t * p )
+{
+    Vec_Wec_t * vClusters = Vec_WecAlloc( 100 );
+    Vec_Int_t * vCluster, * vOrder;
+    int * pParents = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    int * pCluster = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj;
+    int i, iRoot;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        pParents[i] = i;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(Gia_ObjFanin0(pObj)) )
+            Gia_ManMapPartUnion( pParents, i, Gia_ObjFaninId0(pObj, i) );
+        if ( Gia_ObjIsAnd(Gia_ObjFanin1(pObj)) )
+            Gia_ManMapPartUnion( pParents, i, Gia_ObjFaninId1(pObj, i) );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iRoot = Gia_ManMapPartFind( pParents, Gia_ObjIsAnd(Gia_ObjFanin0(pObj)) ? Gia_ObjFaninId0p(p, pObj) : Gia_ObjId(p, pObj) );
+        if ( pCluster[iRoot] == -1 )
+        {
+            pCluster[iRoot] = Vec_WecSize(vClusters);
+            Vec_WecPushLevel( vClusters );
+        }
+        Vec_WecPush( vClusters, pCluster[iRoot], i );
+    }
+    vOrder = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Vec_WecForEachLevel( vClusters, vCluster, i )
+        Vec_IntAppend( vOrder, vCluster );
+    Vec_WecFree( vClusters );
+    ABC_FREE( pParents );
+    ABC_FREE( pCluster );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns AND nodes and COs to the partitions.]
+
+  Description [Returns the owner of each object (-1 for CIs and the
+  constant); fills in the partition of each CO.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManMapPartAssign( Gia_Man_t * p, int nParts, Vec_Int_t * vCoParts )
+{
+    Vec_Int_t * vOwners = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Vec_Int_t * vOrder  = Gia_ManMapPartOrderCos( p );
+    Vec_Int_t * vStack  = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int nTarget = Abc_MaxInt( 1, (Gia_ManAndNum(p) + nParts - 1) / nParts );
+    int i, iCo, iObj, iPart = 0, nOwned = 0;
+    Vec_IntFill( vCoParts, Gia_ManCoNum(p), 0 );
+    Vec_IntForEachEntry( vOrder, iCo, i )
+    {
+        pObj = Gia_ManCo( p, iCo );
+        Vec_IntWriteEntry( vCoParts, iCo, iPart );
+        if ( !Gia_ObjIsAnd(Gia_ObjFanin0(pObj)) || Vec_IntEntry(vOwners, Gia_ObjFaninId0p(p, pObj)) >= 0 )
+            continue;
+        // claim the part of the cone not owned by the previous COs
+        Vec_IntPush( vStack, Gia_ObjFaninId0p(p, pObj) );
+        Vec_IntWriteEntry( vOwners, Gia_ObjFaninId0p(p, pObj), iPart );
+        while ( Vec_IntSize(vStack) )
+        {
+            iObj = Vec_IntPop( vStack );
+            pObj = Gia_ManObj( p, iObj );
+            nOwned++;
+            if ( Gia_ObjIsAnd(Gia_ObjFanin0(pObj)) && Vec_IntEntry(vOwners, Gia_ObjFaninId0(pObj, iObj)) == -1 )
+            {
+                Vec_IntWriteEntry( vOwners, Gia_ObjFaninId0(pObj, iObj), iPart );
+                Vec_IntPush( vStack, Gia_ObjFaninId0(pObj, iObj) );
+            }
+            if ( Gia_ObjIsAnd(Gia_ObjFanin1(pObj)) && Vec_IntEntry(vOwners, Gia_ObjFaninId1(pObj, iObj)) == -1 )
+            {
+                Vec_IntWriteEntry( vOwners, Gia_ObjFaninId1(pObj, iObj), iPart );
+                Vec_IntPush( vStack, Gia_ObjFaninId1(pObj, iObj) );
+            }
+        }
+        if ( nOwned >= nTarget * (iPart + 1) && iPart < nParts - 1 )
+            iPart++;
+    }
+    Vec_IntFree( vStack );
+    Vec_IntFree( vOrder );
+    return vOwners;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the subject graph of one partition.]
+
+  Description [The CIs are the original CIs and the boundary nodes used
+  by the partition. The COs are the original COs of the partition
+  followed by the owned nodes used by other partitions.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManMapPartDerive( Gia_Man_t * p, int iPart, Vec_Int_t * vOwners, Vec_Int_t * vCoParts, Vec_Bit_t * vExport, Vec_Int_t * vSub2Obj )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, k, iFan, nNodes = 0;
+    Vec_IntClear( vSub2Obj );
+    Vec_IntPush( vSub2Obj, 0 );
+    // collect the inputs in the order of their IDs
+    Gia_ManIncrementTravId( p );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Vec_IntEntry(vOwners, i) != iPart )
+            continue;
+        nNodes++;
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, i) : Gia_ObjFaninId0(pObj, i);
+            if ( iFan > 0 && Vec_IntEntry(vOwners, iFan) != iPart )
+                Gia_ObjSetTravIdCurrentId( p, iFan );
+        }
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iFan = Gia_ObjFaninId0p( p, pObj );
+        if ( Vec_IntEntry(vCoParts, i) == iPart && iFan > 0 && Vec_IntEntry(vOwners, iFan) != iPart )
+            Gia_ObjSetTravIdCurrentId( p, iFan );
+    }
+    pNew = Gia_ManStart( 1 + Gia_ManCiNum(p) + nNodes + Gia_ManCoNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachObj1( p, pObj, i )
+        if ( Gia_ObjIsTravIdCurrentId(p, i) )
+        {
+            pObj->Value = Gia_ManAppendCi( pNew );
+            Vec_IntPush( vSub2Obj, i );
+        }
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( Vec_IntEntry(vOwners, i) == iPart )
+        {
+            pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Vec_IntPush( vSub2Obj, i );
+        }
+    Gia_ManForEachCo( p, pObj, i )
+        if ( Vec_IntEntry(vCoParts, i) == iPart )
+        {
+            Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+            Vec_IntPush( vSub2Obj, -1 );
+        }
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( Vec_IntEntry(vOwners, i) == iPart && Vec_BitEntry(vExport, i) )
+        {
+            Gia_ManAppendCo( pNew, pObj->Value );
+            Vec_IntPush( vSub2Obj, -1 );
+        }
+    assert( Vec_IntSize(vSub2Obj) == Gia_ManObjNum(pNew) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps one partition.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManMapPartOne( Gia_MapPart_t * pPart )
+{
+    pPart->pRes = pPart->pFuncMap( pPart->pSub, &pPart->Pars );
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Gia_ManMapPartThread( void * pArg )
+{
+    Gia_ManMapPartOne( (Gia_MapPart_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+void Gia_ManMapPartRun( Gia_MapPart_t * pParts, int nParts )
+{
+    pthread_t WorkerThread[GIA_MAP_PART_MAX];
+    int i, status;
+    for ( i = 0; i < nParts; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_ManMapPartThread, (void *)(pParts + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nParts; i++ )
+        pthread_join( WorkerThread[i], NULL );
+}
+#else // pthreads are not used
+void Gia_ManMapPartRun( Gia_MapPart_t * pParts, int nParts )
+{
+    int i;
+    for ( i = 0; i < nParts; i++ )
+        Gia_ManMapPartOne( pParts + i );
+}
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs LUT mapping of the partitions on separate threads.]
+
+  Description [The partitions are mapped by pFuncMap (Lf_ManPerformMapping
+  or Mf_ManPerformMapping) with their own managers and cut stores. The
+  subject graphs are not restructured (no coarsening or cut minimization),
+  so that the mappings of the partitions can be transferred back to the
+  original AIG, which is returned with the mapping attached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManPerformMappingPart( Gia_Man_t * p, Jf_Par_t * pPars, Gia_Man_t * (* pFuncMap)( Gia_Man_t *, Jf_Par_t * ) )
+{
+    Gia_MapPart_t * pParts, * pPart;
+    Vec_Int_t * vCoParts = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Vec_Int_t * vOwners, * vMapping;
+    Vec_Bit_t * vExport;
+    Gia_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int nParts = Abc_MinInt( pPars->nProcNum, GIA_MAP_PART_MAX );
+    int i, k, t, iFan, iOwner, nMapped = 0;
+    assert( nParts > 1 && !Gia_ManHasChoices(p) && p->pMuxes == NULL );
+    ABC_FREE( p->pRefs );
+    Vec_IntFreeP( &p->vMapping );
+    // assign the nodes and find the boundary
+    vOwners = Gia_ManMapPartAssign( p, nParts, vCoParts );
+    vExport = Vec_BitStart( Gia_ManObjNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, i) : Gia_ObjFaninId0(pObj, i);
+            iOwner = Vec_IntEntry( vOwners, iFan );
+            if ( iOwner >= 0 && iOwner != Vec_IntEntry(vOwners, i) )
+                Vec_BitWriteEntry( vExport, iFan, 1 );
+        }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iOwner = Vec_IntEntry( vOwners, Gia_ObjFaninId0p(p, pObj) );
+        if ( iOwner >= 0 && iOwner != Vec_IntEntry(vCoParts, i) )
+            Vec_BitWriteEntry( vExport, Gia_ObjFaninId0p(p, pObj), 1 );
+    }
+    // derive the subject graphs
+    pParts = ABC_CALLOC( Gia_MapPart_t, nParts );
+    for ( t = 0; t < nParts; t++ )
+    {
+        pPart = pParts + nMapped;
+        pPart->vSub2Obj = Vec_IntAlloc( 1000 );
+        pPart->pSub     = Gia_ManMapPartDerive( p, t, vOwners, vCoParts, vExport, pPart->vSub2Obj );
+        // skip the partitions without internal nodes
+        if ( Gia_ManAndNum(pPart->pSub) == 0 )
+        {
+            Gia_ManStop( pPart->pSub );
+            Vec_IntFree( pPart->vSub2Obj );
+            continue;
+        }
+        nMapped++;
+        pPart->pFuncMap = pFuncMap;
+        pPart->Pars     = *pPars;
+        pPart->Pars.nProcNum     = 0;
+        pPart->Pars.fCoarsen     = 0;
+        pPart->Pars.fVerbose     = 0;
+        pPart->Pars.fVeryVerbose = 0;
+    }
+    Gia_ManMapPartRun( pParts, nMapped );
+    // transfer the mapping
+    vMapping = Vec_IntStart( Gia_ManObjNum(p) );
+    for ( t = 0; t < nMapped; t++ )
+    {
+        Gia_Man_t * pRes = pParts[t].pRes;
+        Vec_Int_t * vSub2Obj = pParts[t].vSub2Obj;
+        assert( pRes == pParts[t].pSub && Gia_ManHasMapping(pRes) );
+        Gia_ManForEachLut( pRes, i )
+        {
+            Vec_IntWriteEntry( vMapping, Vec_IntEntry(vSub2Obj, i), Vec_IntSize(vMapping) );
+            Vec_IntPush( vMapping, Gia_ObjLutSize(pRes, i) );
+            Gia_LutForEachFanin( pRes, i, iFan, k )
+                Vec_IntPush( vMapping, Vec_IntEntry(vSub2Obj, iFan) );
+            Vec_IntPush( vMapping, Vec_IntEntry(vSub2Obj, i) );
+        }
+        Gia_ManStop( pRes );
+        Vec_IntFree( vSub2Obj );
+    }
+    p->vMapping = vMapping;
+    Gia_ManMappingVerify( p );
+    // report the results
+    pPars->Area = Gia_ManLutNum( p );
+    pPars->Edge = Gia_ManLutFaninCount( p );
+    pPars->Delay = Gia_ManLutLevel( p, NULL );
+    if ( pPars->fVerbose )
+    {
+        printf( "Partitions = %d  Boundary = %d  ", nMapped, Vec_BitCount(vExport) );
+        printf( "Level =%6ld   Area =%9ld   Edge =%9ld   ", (long)pPars->Delay, (long)pPars->Area, (long)pPars->Edge );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    ABC_FREE( pParts );
+    Vec_BitFree( vExport );
+    Vec_IntFree( vOwners );
+    Vec_IntFree( vCoParts );
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
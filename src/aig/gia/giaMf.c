@@ -1656,6 +1656,9 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Mf_Man_t * p;
     Gia_Man_t * pNew, * pCls;
+    if ( pPars->nProcNum > 1 && !pPars->fGenCnf && !pPars->fCutMin && !Gia_ManHasChoices(pGia) && pGia->pMuxes == NULL && 
+         pGia->pManTime == NULL && !Gia_ManBufNum(pGia) )
+        return Gia_ManPerformMappingPart( pGia, pPars, Mf_ManPerformMapping );
     if ( pPars->fGenCnf )
         pPars->fCutMin = 1;
     if ( Gia_ManHasChoices(pGia) )
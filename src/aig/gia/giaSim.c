@@ -395,25 +395,7 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    Abc_SimdAndU( pInfo, pInfo0, Gia_ObjFaninC0(pObj), pInfo1, Gia_ObjFaninC1(pObj), 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -1253,15 +1235,11 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
 }
 static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
-    word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
     word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+    word * pSims2 = pSims + nWords*i;
+    Abc_SimdAnd( pSims2, pSims0, Gia_ObjFaninC0(pObj), pSims1, Gia_ObjFaninC1(pObj), 0, nWords );
 }
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -217,25 +217,7 @@ static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo  = Gia_Sim2Data( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
     unsigned * pInfo1 = Gia_Sim2Data( p, Gia_ObjFaninId1(pObj, Gia_ObjValue(pObj)) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    Abc_SimdAndU( pInfo, pInfo0, Gia_ObjFaninC0(pObj), pInfo1, Gia_ObjFaninC1(pObj), 0, p->nWords );
 }
 
 /**Function*************************************************************
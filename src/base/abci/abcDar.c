@@ -1589,7 +1589,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1601,7 +1601,7 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    pMan = Dar_ManCompress2Mt( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nThreads, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1800,7 +1800,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fStreaming, int nThreads, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1824,11 +1824,31 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // derive CNF and write it into the file without storing the clauses
+    if ( !fFastAlgo && fStreaming && strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
+    {
+        int nVars = 0, nClauses = 0, nLiterals = 0;
+        Cnf_ManPrepare();
+        Cnf_ManRead()->nThreads = nThreads;
+        if ( Cnf_DeriveIntoFile( pMan, pFileName, fChangePol, &nVars, &nClauses, &nLiterals ) )
+        {
+            Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return NULL;
+    }
+
     // derive CNF
     if ( fFastAlgo )
         pCnf = Cnf_DeriveFast( pMan, 0 );
     else
+    {
+        Cnf_ManPrepare();
+        Cnf_ManRead()->nThreads = nThreads;
         pCnf = Cnf_Derive( pMan, 0 );
+    }
 
     // adjust polarity
     if ( fChangePol )
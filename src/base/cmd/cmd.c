@@ -49,6 +49,7 @@ static int CmdCommandUnsetVariable ( Abc_Frame_t * pAbc, int argc, char ** argv
 static int CmdCommandUndo          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandRecall        ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEmpty         ( Abc_Frame_t * pAbc, int argc, char ** argv );
+extern void Gia_ArenaSetEnabled( int fEnable );
 #if defined(WIN32) && !defined(__cplusplus)
 static int CmdCommandScanDir       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandRenameFiles   ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -822,6 +823,8 @@ int CmdCommandSetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             setvbuf( pAbc->Err, ( char * ) NULL, _IOLBF, 0 );
 #endif
         }
+        if ( strcmp( argv[1], "gianoarena" ) == 0 )
+            Gia_ArenaSetEnabled( 0 );
         if ( strcmp( argv[1], "history" ) == 0 )
         {
             if ( pAbc->Hst != NULL )
@@ -890,6 +893,8 @@ int CmdCommandUnsetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             ABC_FREE( key );
             ABC_FREE( value );
         }
+        if ( strcmp( argv[i], "gianoarena" ) == 0 )
+            Gia_ArenaSetEnabled( 1 );
     }
     return 0;
 
@@ -2074,19 +2074,34 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int fFastAlgo;
     int fAllPrimes;
     int fChangePol;
+    int fStreaming;
+    int nThreads;
     int fVerbose;
-    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fStreaming, int nThreads, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
     fAllPrimes = 0;
     fChangePol = 1;
+    fStreaming = 1;
+    nThreads = 0;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnfpcsvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 0 )
+                    goto usage;
+                break;
             case 'n':
                 fNewAlgo ^= 1;
                 break;
@@ -2099,6 +2114,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
             case 'c':
                 fChangePol ^= 1;
                 break;
+            case 's':
+                fStreaming ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -2125,9 +2143,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     // call the corresponding file writer
     if ( fFastAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, 0, 0, fVerbose );
     else if ( fNewAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fStreaming, nThreads, fVerbose );
     else if ( fAllPrimes )
         Io_WriteCnf( pAbc->pNtkCur, pFileName, 1 );
     else
@@ -2135,12 +2153,14 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-P num] [-nfpcsvh] <file>\n" );
     fprintf( pAbc->Err, "\t         generates CNF for the miter (see also \"&write_cnf\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads deriving CNF (0 = no threads) [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
     fprintf( pAbc->Err, "\t-c     : toggle adjasting polarity of internal variables [default = %s]\n", fChangePol? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-s     : toggle writing clauses without storing them in memory [default = %s]\n", fStreaming? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
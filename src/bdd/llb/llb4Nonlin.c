@@ -22,6 +22,17 @@
 #include "base/abc/abc.h"
 #include "aig/gia/giaAig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
  
 
@@ -29,6 +40,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define LLB_PART_MAX 64
+
 typedef struct Llb_Mnx_t_ Llb_Mnx_t;
 struct Llb_Mnx_t_
 {
@@ -49,6 +62,11 @@ struct Llb_Mnx_t_
     Vec_Int_t *     vOrder;         // for each object ID, its BDD variable number or -1
     Vec_Int_t *     vVars2Q;        // 1 if variable is quantifiable; 0 othervise
 
+    // partitioned image computation
+    int             nParts;         // the number of state-set partitions
+    DdManager **    pDdParts;       // the BDD manager of each partition
+    Vec_Ptr_t **    pvRootsParts;   // the transition relation in these managers
+
     abctime         timeImage;
     abctime         timeRemap;
     abctime         timeReo;
@@ -564,6 +582,248 @@ void Llb_Nonlin4Deref( DdManager * dd, Vec_Ptr_t * vParts )
     Vec_PtrFree( vParts );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Selects the variables used to partition the state set.]
+
+  Description [Prefers the variables whose cofactors are the smallest,
+  which tends to produce balanced partitions. Returns at most nVars
+  variables from the support of the state set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Llb_Nonlin4SplitVars( DdManager * dd, DdNode * bFunc, int nVars )
+{
+    Vec_Int_t * vVars, * vCands, * vCosts;
+    DdNode * bVar, * bCof0, * bCof1;
+    int i, Cost0, Cost1, * pSupp, * pOrder;
+    abctime TimeStop;
+    TimeStop = dd->TimeStop;  dd->TimeStop = 0;
+    vCands = Vec_IntAlloc( 100 );
+    vCosts = Vec_IntAlloc( 100 );
+    pSupp  = Cudd_SupportIndex( dd, bFunc );
+    for ( i = 0; i < Cudd_ReadSize(dd); i++ )
+    {
+        if ( !pSupp[i] )
+            continue;
+        bVar  = Cudd_bddIthVar( dd, i );
+        bCof0 = Cudd_Cofactor( dd, bFunc, Cudd_Not(bVar) );  Cudd_Ref( bCof0 );
+        bCof1 = Cudd_Cofactor( dd, bFunc, bVar );            Cudd_Ref( bCof1 );
+        Cost0 = Cudd_DagSize( bCof0 );
+        Cost1 = Cudd_DagSize( bCof1 );
+        Cudd_RecursiveDeref( dd, bCof0 );
+        Cudd_RecursiveDeref( dd, bCof1 );
+        Vec_IntPush( vCands, i );
+        Vec_IntPush( vCosts, Abc_MaxInt(Cost0, Cost1) );
+    }
+    ABC_FREE( pSupp );
+    pOrder = Abc_QuickSortCost( Vec_IntArray(vCosts), Vec_IntSize(vCosts), 0 );
+    vVars  = Vec_IntAlloc( nVars );
+    for ( i = 0; i < Vec_IntSize(vCands) && i < nVars; i++ )
+        Vec_IntPush( vVars, Vec_IntEntry(vCands, pOrder[i]) );
+    ABC_FREE( pOrder );
+    Vec_IntFree( vCands );
+    Vec_IntFree( vCosts );
+    dd->TimeStop = TimeStop;
+    return vVars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the BDD managers of the state-set partitions.]
+
+  Description [Each manager gets its own copy of the transition relation
+  and starts with the current variable order of the main manager.
+  Dynamic reordering is not enabled in these managers because CUDD keeps
+  the state of the reordering procedures in static variables, which
+  would be shared by the threads. The managers are reordered serially
+  between the image computations instead.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4StartParts( Llb_Mnx_t * p )
+{
+    DdNode * bFunc;
+    int i, k;
+    abctime TimeStop;
+    TimeStop = p->dd->TimeStop;  p->dd->TimeStop = 0;
+    p->nParts       = 1 << Abc_Base2Log( Abc_MinInt(p->pPars->nThreads, LLB_PART_MAX) );
+    p->pDdParts     = ABC_CALLOC( DdManager *, p->nParts );
+    p->pvRootsParts = ABC_CALLOC( Vec_Ptr_t *, p->nParts );
+    for ( i = 0; i < p->nParts; i++ )
+    {
+        p->pDdParts[i] = Cudd_Init( Cudd_ReadSize(p->dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_ShuffleHeap( p->pDdParts[i], p->dd->invperm );
+        Cudd_SetMaxGrowth( p->pDdParts[i], 1.05 );
+        p->pvRootsParts[i] = Vec_PtrAlloc( Vec_PtrSize(p->vRoots) );
+        Vec_PtrForEachEntry( DdNode *, p->vRoots, bFunc, k )
+        {
+            bFunc = Cudd_bddTransfer( p->dd, p->pDdParts[i], bFunc );  Cudd_Ref( bFunc );
+            Vec_PtrPush( p->pvRootsParts[i], bFunc );
+        }
+    }
+    p->dd->TimeStop = TimeStop;
+}
+void Llb_Nonlin4ReorderParts( Llb_Mnx_t * p )
+{
+    DdManager * dd;
+    int i;
+    for ( i = 0; i < p->nParts; i++ )
+    {
+        dd = p->pDdParts[i];
+        // reorder when dynamic reordering would have been triggered
+        if ( Cudd_ReadKeys(dd) - Cudd_ReadDead(dd) >= Cudd_ReadNextReordering(dd) )
+            Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+    }
+}
+void Llb_Nonlin4StopParts( Llb_Mnx_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nParts; i++ )
+    {
+        Llb_Nonlin4Deref( p->pDdParts[i], p->pvRootsParts[i] );
+        Extra_StopManager( p->pDdParts[i] );
+    }
+    ABC_FREE( p->pDdParts );
+    ABC_FREE( p->pvRootsParts );
+    p->nParts = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of the state set by partitions.]
+
+  Description [The state set is cofactored by the splitting variables.
+  Each non-empty partition is transferred into its own BDD manager, which
+  computes the image on a separate thread. The images are transferred
+  back and added up in the main manager, and the managers of the
+  partitions are reordered if they have grown. Returns NULL on timeout.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Llb_ImgThData_t_
+{
+    DdManager *  dd;            // the manager of the partition
+    Vec_Ptr_t *  vRoots;        // the transition relation in this manager
+    Vec_Int_t *  vVars2Q;       // the quantifiable variables
+    DdNode *     bCurrent;      // the partition of the state set
+    DdNode *     bImage;        // the image of the partition
+    abctime      TimeLeft;      // the remaining runtime (0 = no limit)
+} Llb_ImgThData_t;
+
+void * Llb_Nonlin4ImageWorker( void * pArg )
+{
+    Llb_ImgThData_t * pThData = (Llb_ImgThData_t *)pArg;
+    // the clock is measured per thread
+    pThData->dd->TimeStop = pThData->TimeLeft ? Abc_Clock() + pThData->TimeLeft : 0;
+    pThData->bImage = Llb_Nonlin4Image( pThData->dd, pThData->vRoots, pThData->bCurrent, pThData->vVars2Q );
+    if ( pThData->bImage )
+        Cudd_Ref( pThData->bImage );
+    pThData->dd->TimeStop = 0;
+    return NULL;
+}
+DdNode * Llb_Nonlin4ImagePart( Llb_Mnx_t * p, DdNode * bCurrent )
+{
+    Llb_ImgThData_t ThData[LLB_PART_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[LLB_PART_MAX];
+    int status;
+#endif
+    Vec_Int_t * vVars;
+    DdNode * bCube, * bVar, * bPart, * bImage, * bTemp, * bRes;
+    int i, k, iVar, nParts = 0, fTimeOut = 0;
+    abctime TimeStop, TimeLeft = 0;
+    if ( p->pPars->TimeTarget )
+    {
+        TimeLeft = p->pPars->TimeTarget - Abc_Clock();
+        if ( TimeLeft < 1 )
+            TimeLeft = 1;
+    }
+    TimeStop = p->dd->TimeStop;  p->dd->TimeStop = 0;
+    // split the state set
+    vVars = Llb_Nonlin4SplitVars( p->dd, bCurrent, Abc_Base2Log(p->nParts) );
+    for ( i = 0; i < (1 << Vec_IntSize(vVars)); i++ )
+    {
+        bCube = Cudd_ReadOne( p->dd );  Cudd_Ref( bCube );
+        Vec_IntForEachEntry( vVars, iVar, k )
+        {
+            bVar  = Cudd_NotCond( Cudd_bddIthVar(p->dd, iVar), !((i >> k) & 1) );
+            bCube = Cudd_bddAnd( p->dd, bTemp = bCube, bVar );  Cudd_Ref( bCube );
+            Cudd_RecursiveDeref( p->dd, bTemp );
+        }
+        bPart = Cudd_bddAnd( p->dd, bCurrent, bCube );  Cudd_Ref( bPart );
+        Cudd_RecursiveDeref( p->dd, bCube );
+        if ( bPart == Cudd_ReadLogicZero(p->dd) )
+        {
+            Cudd_RecursiveDeref( p->dd, bPart );
+            continue;
+        }
+        ThData[nParts].dd       = p->pDdParts[nParts];
+        ThData[nParts].vRoots   = p->pvRootsParts[nParts];
+        ThData[nParts].vVars2Q  = p->vVars2Q;
+        ThData[nParts].bCurrent = Cudd_bddTransfer( p->dd, p->pDdParts[nParts], bPart );  Cudd_Ref( ThData[nParts].bCurrent );
+        ThData[nParts].bImage   = NULL;
+        ThData[nParts].TimeLeft = TimeLeft;
+        Cudd_RecursiveDeref( p->dd, bPart );
+        nParts++;
+    }
+    Vec_IntFree( vVars );
+    // compute the images
+#ifdef ABC_USE_PTHREADS
+    for ( i = 1; i < nParts; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_Nonlin4ImageWorker, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    if ( nParts > 0 )
+        Llb_Nonlin4ImageWorker( ThData + 0 );
+    for ( i = 1; i < nParts; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#else
+    for ( i = 0; i < nParts; i++ )
+        Llb_Nonlin4ImageWorker( ThData + i );
+#endif
+    // collect the images
+    bRes = Cudd_ReadLogicZero( p->dd );  Cudd_Ref( bRes );
+    for ( i = 0; i < nParts; i++ )
+    {
+        Cudd_RecursiveDeref( ThData[i].dd, ThData[i].bCurrent );
+        if ( ThData[i].bImage == NULL )
+        {
+            fTimeOut = 1;
+            continue;
+        }
+        if ( !fTimeOut )
+        {
+            bImage = Cudd_bddTransfer( ThData[i].dd, p->dd, ThData[i].bImage );  Cudd_Ref( bImage );
+            bRes   = Cudd_bddOr( p->dd, bTemp = bRes, bImage );                    Cudd_Ref( bRes );
+            Cudd_RecursiveDeref( p->dd, bTemp );
+            Cudd_RecursiveDeref( p->dd, bImage );
+        }
+        Cudd_RecursiveDeref( ThData[i].dd, ThData[i].bImage );
+    }
+    p->dd->TimeStop = TimeStop;
+    if ( !fTimeOut )
+        Llb_Nonlin4ReorderParts( p );
+    if ( fTimeOut )
+    {
+        Cudd_RecursiveDeref( p->dd, bRes );
+        return NULL;
+    }
+    Cudd_Deref( bRes );
+    return bRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives counter-example by backward reachability.]
@@ -770,7 +1030,10 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        if ( p->nParts > 1 )
+            p->bNext = Llb_Nonlin4ImagePart( p, p->bCurrent );
+        else
+            p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -973,6 +1236,13 @@ Llb_Mnx_t * Llb_MnxStart( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     if ( pPars->fReorder )
         Llb_Nonlin4Reorder( p->dd, 0, 1 );
+    // the partitions are not derived if the timeout was reached
+    if ( pPars->nThreads > 1 && p->vRoots )
+    {
+        Llb_Nonlin4StartParts( p );
+        if ( pPars->fVerbose )
+            printf( "Computing images of %d state-set partitions concurrently.\n", p->nParts );
+    }
     return p;
 }
  
@@ -1016,6 +1286,8 @@ void Llb_MnxStop( Llb_Mnx_t * p )
     if ( p->vRoots )
     Vec_PtrForEachEntry( DdNode *, p->vRoots, bTemp, i )
         Cudd_RecursiveDeref( p->dd, bTemp );
+    if ( p->pDdParts )
+        Llb_Nonlin4StopParts( p );
     // remove arrays
     Vec_PtrFreeP( &p->vRings );
     Vec_PtrFreeP( &p->vRoots );
@@ -143,6 +143,7 @@ struct If_Par_t_
     int                fDeriveLuts;   // enables deriving LUT structures
     int                fDoAverage;    // optimize average rather than maximum level
     int                fHashMapping;  // perform AIG hashing after mapping
+    int                nThreads;      // the number of threads for level-parallel cut computation
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
@@ -198,6 +199,7 @@ struct If_Man_t_
     Vec_Ptr_t *        vCos;          // the primary outputs
     Vec_Ptr_t *        vObjs;         // all objects
     Vec_Ptr_t *        vObjsRev;      // reverse topological order of objects
+    Vec_Wec_t *        vLevels;       // internal nodes grouped by logic level
     Vec_Ptr_t *        vTemp;         // temporary array
     int                nObjs[IF_VOID];// the number of objects by type
     // various data
@@ -568,6 +570,8 @@ extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nC
 extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
+extern If_DsdMan_t *   If_DsdManLoadCache( char * pFileName, int nVars, int LutSize, int fVerbose );
+extern void            If_DsdManSaveCache( If_DsdMan_t * p, char * pFileName, int fVerbose );
 extern void            If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew );
 extern void            If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
@@ -633,6 +637,9 @@ extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 /*=== ifMap.c =============================================================*/
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
+extern void            If_ObjPerformMappingAndStart( If_Man_t * p, If_Obj_t * pObj, int Mode );
+extern int             If_ObjPerformMappingAndCuts( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
+extern void            If_ObjPerformMappingAndStop( If_Man_t * p, If_Obj_t * pObj, int Mode );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
 /*=== ifReduce.c ==========================================================*/
@@ -676,6 +683,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern Vec_Wec_t *     If_ManCollectLevels( If_Man_t * p );
+extern int             If_ManCrossCutLevels( If_Man_t * p, Vec_Wec_t * vLevels );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
@@ -83,7 +83,13 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( p->pPars->nThreads > 0 )
+    {
+        p->vLevels = If_ManCollectLevels( p );
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevels(p, p->vLevels)) );
+    }
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
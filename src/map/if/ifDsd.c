@@ -25,6 +25,7 @@
 #include "sat/bsat/satSolver.h"
 #include "aig/gia/gia.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilSignal.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -41,6 +42,13 @@
 
 #endif
 
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -50,6 +58,15 @@ ABC_NAMESPACE_IMPL_START
 
 #define DSD_VERSION "dsd1"
 
+// reader of a DSD manager file mapped into memory
+typedef struct If_DsdRead_t_ If_DsdRead_t;
+struct If_DsdRead_t_
+{
+    char *         pCur;           // the current position
+    char *         pEnd;           // the end of the file
+    int            fError;         // set when the file is truncated or corrupted
+};
+
 // network types
 typedef enum { 
     IF_DSD_NONE = 0,               // 0:  unknown
@@ -1103,101 +1120,250 @@ void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
         fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
     fclose( pFile );
 }
+static inline void If_DsdReadData( If_DsdRead_t * p, void * pData, int nBytes )
+{
+    if ( p->fError || nBytes < 0 || nBytes > p->pEnd - p->pCur )
+    {
+        memset( pData, 0, Abc_MaxInt(nBytes, 0) );
+        p->fError = 1;
+        return;
+    }
+    memcpy( pData, p->pCur, nBytes );
+    p->pCur += nBytes;
+}
+static inline int If_DsdReadInt( If_DsdRead_t * p )
+{
+    int Num;
+    If_DsdReadData( p, &Num, 4 );
+    return Num;
+}
 If_DsdMan_t * If_DsdManLoad( char * pFileName )
 {
     If_DsdMan_t * p;
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
-    char pBuffer[10];
+    If_DsdRead_t Read, * pRead = &Read;
     unsigned * pSpot;
     word * pTruth;
-    int i, v, Num, Num2, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
+    char * pContents;
+    size_t nFileSize;
+    int i, v, Num, Num2, fMapped;
+    // the file is mapped into memory and parsed in place
+    pContents = Gia_FileMap( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
     {
         printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
         return NULL;
     }
-    RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    pRead->pCur   = pContents;
+    pRead->pEnd   = pContents + nFileSize;
+    pRead->fError = 0;
+    if ( nFileSize < 8 || strncmp(pContents, DSD_VERSION, strlen(DSD_VERSION)) )
     {
         printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        Gia_FileUnmap( pContents, nFileSize, fMapped );
+        return NULL;
+    }
+    pRead->pCur += 4;
+    Num = If_DsdReadInt( pRead );
+    if ( Num < 0 || Num > DAU_MAX_VAR )
+    {
+        printf( "The number of variables (%d) in file \"%s\" exceeds the precompiled limit (%d).\n", Num, pFileName, DAU_MAX_VAR );
+        Gia_FileUnmap( pContents, nFileSize, fMapped );
         return NULL;
     }
-    RetValue = fread( &Num, 4, 1, pFile );
     p = If_DsdManAlloc( Num, 0 );
     ABC_FREE( p->pStore );
     p->pStore = Abc_UtilStrsav( pFileName );
-    RetValue = fread( &Num, 4, 1, pFile );
-    p->LutSize = Num;
+    p->LutSize = If_DsdReadInt( pRead );
     p->pSat  = If_ManSatBuildXY( p->LutSize );
-    RetValue = fread( &Num, 4, 1, pFile );
-    assert( Num >= 2 );
+    Num = If_DsdReadInt( pRead );
+    if ( Num < 2 || (size_t)Num > nFileSize )
+        pRead->fError = 1, Num = 2;
     Vec_PtrFillExtra( &p->vObjs, Num, NULL );
     Vec_IntFill( &p->vNexts, Num, 0 );
     Vec_IntFill( &p->vTruths, Num, -1 );
     p->nBins = Abc_PrimeCudd( 2*Num );
     p->pBins = ABC_REALLOC( unsigned, p->pBins, p->nBins );
     memset( p->pBins, 0, sizeof(unsigned) * p->nBins );
-    for ( i = 2; i < Vec_PtrSize(&p->vObjs); i++ )
+    for ( i = 2; i < Vec_PtrSize(&p->vObjs) && !pRead->fError; i++ )
     {
-        RetValue = fread( &Num, 4, 1, pFile );
+        Num = If_DsdReadInt( pRead );
+        if ( Num < 1 || Num > If_DsdObjWordNum(DAU_MAX_VAR) )
+        {
+            pRead->fError = 1;
+            break;
+        }
         pObj = (If_DsdObj_t *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * Num );
-        RetValue = fread( pObj, sizeof(word)*Num, 1, pFile );
-        Vec_PtrWriteEntry( &p->vObjs, i, pObj );
-        if ( pObj->Type == IF_DSD_PRIME )
+        If_DsdReadData( pRead, pObj, sizeof(word) * Num );
+        if ( pRead->fError || pObj->Id != (unsigned)i || (int)pObj->nFans > p->nVars || Num != If_DsdObjWordNum(pObj->nFans) )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
-            Vec_IntWriteEntry( &p->vTruths, i, Num );
+            pRead->fError = 1;
+            break;
         }
+        for ( v = 0; v < (int)pObj->nFans; v++ )
+            if ( Abc_Lit2Var(pObj->pFans[v]) >= i )
+                pRead->fError = 1;
+        Vec_PtrWriteEntry( &p->vObjs, i, pObj );
+        if ( pObj->Type == IF_DSD_PRIME )
+            Vec_IntWriteEntry( &p->vTruths, i, If_DsdReadInt(pRead) );
         pSpot = If_DsdObjHashLookup( p, pObj->Type, (int *)pObj->pFans, pObj->nFans, If_DsdObjTruthId(p, pObj) );
-        assert( *pSpot == 0 );
+        if ( *pSpot != 0 )
+            pRead->fError = 1;
         *pSpot = pObj->Id;
     }
+    if ( pRead->fError )
+    {
+        printf( "File \"%s\" is truncated or corrupted.\n", pFileName );
+        If_DsdManFree( p, 0 );
+        Gia_FileUnmap( pContents, nFileSize, fMapped );
+        return NULL;
+    }
     assert( p->nUniqueMisses == Vec_PtrSize(&p->vObjs) - 2 );
     p->nUniqueMisses = 0;
     pTruth = ABC_ALLOC( word, p->nWords );
-    for ( v = 3; v <= p->nVars; v++ )
+    for ( v = 3; v <= p->nVars && !pRead->fError; v++ )
     {
         int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtMem[v]);
-        RetValue = fread( &Num, 4, 1, pFile );
-        for ( i = 0; i < Num; i++ )
+        Num = If_DsdReadInt( pRead );
+        for ( i = 0; i < Num && !pRead->fError; i++ )
         {
-            RetValue = fread( pTruth, nBytes, 1, pFile );
+            If_DsdReadData( pRead, pTruth, nBytes );
             Vec_MemHashInsert( p->vTtMem[v], pTruth );
         }
-        assert( Num == Vec_MemEntryNum(p->vTtMem[v]) );
-        RetValue = fread( &Num2, 4, 1, pFile );
-        for ( i = 0; i < Num2; i++ )
+        assert( pRead->fError || Num == Vec_MemEntryNum(p->vTtMem[v]) );
+        Num2 = If_DsdReadInt( pRead );
+        for ( i = 0; i < Num2 && !pRead->fError; i++ )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
+            Num = If_DsdReadInt( pRead );
+            if ( Num < 0 || Num > pRead->pEnd - pRead->pCur )
+            {
+                pRead->fError = 1;
+                break;
+            }
             vSets = Vec_IntAlloc( Num );
-            RetValue = fread( Vec_IntArray(vSets), sizeof(int)*Num, 1, pFile );
+            If_DsdReadData( pRead, Vec_IntArray(vSets), sizeof(int)*Num );
             vSets->nSize = Num;
             Vec_PtrPush( p->vTtDecs[v], vSets );
         }
-        assert( Num2 == Vec_PtrSize(p->vTtDecs[v]) ); 
+        assert( pRead->fError || Num2 == Vec_PtrSize(p->vTtDecs[v]) ); 
     }
     ABC_FREE( pTruth );
-    RetValue = fread( &Num, 4, 1, pFile );
-    p->nConfigWords = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
-    p->nTtBits = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
-    {
-        p->vConfigs = Vec_WrdStart( Num );
-        RetValue = fread( Vec_WrdArray(p->vConfigs), sizeof(word)*Num, 1, pFile );
+    // truth tables of prime nodes should be present
+    Vec_PtrForEachEntryStart( If_DsdObj_t *, &p->vObjs, pObj, i, 2 )
+        if ( !pRead->fError && If_DsdObjTruthId(p, pObj) >= 0 && If_DsdObjTruthId(p, pObj) >= Vec_MemEntryNum(p->vTtMem[pObj->nFans]) )
+            pRead->fError = 1;
+    // the remaining sections are optional
+    if ( !pRead->fError && pRead->pCur < pRead->pEnd )
+    {
+        p->nConfigWords = If_DsdReadInt( pRead );
+        p->nTtBits = If_DsdReadInt( pRead );
+        Num = If_DsdReadInt( pRead );
+        if ( !pRead->fError && Num > 0 && Num <= (pRead->pEnd - pRead->pCur) / 8 )
+        {
+            p->vConfigs = Vec_WrdStart( Num );
+            If_DsdReadData( pRead, Vec_WrdArray(p->vConfigs), sizeof(word)*Num );
+        }
+        Num = If_DsdReadInt( pRead );
+        if ( !pRead->fError && Num > 0 && Num <= pRead->pEnd - pRead->pCur )
+        {
+            p->pCellStr = ABC_CALLOC( char, Num + 1 );
+            If_DsdReadData( pRead, p->pCellStr, sizeof(char)*Num );
+        }
     }
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
+    Gia_FileUnmap( pContents, nFileSize, fMapped );
+    if ( pRead->fError )
     {
-        p->pCellStr = ABC_CALLOC( char, Num + 1 );
-        RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
+        printf( "File \"%s\" is truncated or corrupted.\n", pFileName );
+        If_DsdManFree( p, 0 );
+        return NULL;
     }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Persistent DSD manager cache.]
+
+  Description [The cache is a DSD manager file shared by mapping runs. 
+  It is loaded at the start of a run if it is compatible with the run
+  (the number of variables is large enough and the LUT structure is 
+  the same) and is rewritten at the end with everything the run added.
+  The file is replaced atomically, so that concurrent runs never see
+  a partially written cache; the last writer wins.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_DsdMan_t * If_DsdManLoadCache( char * pFileName, int nVars, int LutSize, int fVerbose )
+{
+    If_DsdMan_t * p;
+    abctime clk = Abc_Clock();
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
     fclose( pFile );
+    p = If_DsdManLoad( pFileName );
+    if ( p == NULL )
+        return NULL;
+    if ( p->nVars < nVars || p->LutSize != LutSize )
+    {
+        if ( fVerbose )
+            printf( "DSD cache \"%s\" (vars = %d, LUT size = %d) is not compatible with the current run.\n", pFileName, p->nVars, p->LutSize );
+        If_DsdManFree( p, 0 );
+        return NULL;
+    }
+    if ( fVerbose )
+    {
+        printf( "Loaded %d DSD structures from cache \"%s\".  ", Vec_PtrSize(&p->vObjs) - 2, pFileName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
     return p;
 }
+void If_DsdManSaveCache( If_DsdMan_t * p, char * pFileName, int fVerbose )
+{
+    char * pFileNameTemp = NULL;
+    int fd, pHeader[3] = {0};
+    // do not replace a valid cache created for different parameters
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile != NULL )
+    {
+        int RetValue = fread( pHeader, 4, 3, pFile );
+        fclose( pFile );
+        if ( RetValue == 3 && !strncmp((char *)pHeader, DSD_VERSION, strlen(DSD_VERSION)) && (pHeader[1] != p->nVars || pHeader[2] != p->LutSize) )
+        {
+            if ( fVerbose )
+                printf( "DSD cache \"%s\" is not updated because it was created for different parameters.\n", pFileName );
+            return;
+        }
+    }
+    fd = Util_SignalTmpFile( pFileName, ".tmp", &pFileNameTemp );
+    if ( fd == -1 )
+    {
+        printf( "Cannot create a temporary file to update DSD cache \"%s\".\n", pFileName );
+        return;
+    }
+#ifdef _WIN32
+    _close( fd );
+#else
+    close( fd );
+    chmod( pFileNameTemp, 0644 );
+#endif
+    If_DsdManSave( p, pFileNameTemp );
+#ifdef _WIN32
+    remove( pFileName );
+#endif
+    if ( rename( pFileNameTemp, pFileName ) )
+    {
+        printf( "Cannot update DSD cache \"%s\".\n", pFileName );
+        remove( pFileNameTemp );
+    }
+    else if ( fVerbose )
+        printf( "Saved %d DSD structures into cache \"%s\".\n", Vec_PtrSize(&p->vObjs) - 2, pFileName );
+    free( pFileNameTemp );
+}
 void If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew )
 {
     If_DsdObj_t * pObj; 
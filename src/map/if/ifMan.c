@@ -258,6 +258,7 @@ void If_ManStop( If_Man_t * p )
     Vec_WrdFreeP( &p->vAndGate );
     Vec_WrdFreeP( &p->vOrGate );
     Vec_PtrFreeP( &p->vObjsRev );
+    Vec_WecFreeP( &p->vLevels );
     Vec_PtrFreeP( &p->vLatchOrder );
     Vec_IntFreeP( &p->vLags );
     Vec_IntFreeP( &p->vDump );
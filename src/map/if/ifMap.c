@@ -21,6 +21,17 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -150,39 +161,31 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
 /**Function*************************************************************
 
-  Synopsis    [Finds the best cut for the given node.]
+  Synopsis    [Computes the cuts of the node and selects the best one.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  Only touches the cutset and the best cut of this node, so it can run 
+  concurrently for the nodes on the same logic level (see the conditions 
+  in If_ManPerformMappingUseLevels). Returns the number of merged cuts.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+int If_ObjPerformMappingAndCuts( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
 {
-    If_Set_t * pCutSet;
+    If_Set_t * pCutSet = pObj->pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
     int fFunc0R, fFunc1R;
-    int i, k, v, iCutDsd, fChange;
+    int i, k, v, iCutDsd, fChange, nCutsMerged = 0;
     int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || 
         p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2;
     int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
     assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
     assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
-
-    // prepare
-    if ( Mode == 0 )
-        pObj->EstRefs = (float)pObj->nRefs;
-    else if ( Mode == 1 )
-        pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
-        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
-
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    assert( pCutSet != NULL && pCutSet->nCuts == 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -266,8 +269,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         }
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        nCutsMerged++;
         // check if this cut is contained in any of the available cuts
         if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
             continue;
@@ -477,7 +479,51 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[0]++;
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
+    return nCutsMerged;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the node for cut computation.]
 
+  Description [Updates the fanout estimate, dereferences the best cut
+  in the area recovery modes and fetches the cutset of the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAndStart( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    // prepare
+    if ( Mode == 0 )
+        pObj->EstRefs = (float)pObj->nRefs;
+    else if ( Mode == 1 )
+        pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
+    // deref the selected cut
+    if ( Mode && pObj->nRefs > 0 )
+        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finalizes the node after cut computation.]
+
+  Description [References the best cut in the area recovery modes and
+  recycles the cutsets that are no longer needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAndStop( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    If_Cut_t * pCut;
+    int i;
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
@@ -491,6 +537,27 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     If_ManDerefNodeCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cut for the given node.]
+
+  Description [Mapping modes: delay (0), area flow (1), area (2).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    int nCutsMerged;
+    If_ObjPerformMappingAndStart( p, pObj, Mode );
+    nCutsMerged = If_ObjPerformMappingAndCuts( p, pObj, Mode, fPreprocess, fFirst );
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+    If_ObjPerformMappingAndStop( p, pObj, Mode );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Finds the best cut for the choice node.]
@@ -575,6 +642,210 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping pass can be performed by levels.]
+
+  Description [The cuts of the nodes on the same level are computed 
+  in a batch, which is split among the threads. This is only done when 
+  cut computation does not touch shared data: no truth tables, no choices, 
+  no boxes, no user callbacks. Exact area recovery (Mode 2) is always 
+  performed node by node because it references and dereferences the 
+  cones of other nodes during cut evaluation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingUseLevels( If_Man_t * p, int Mode )
+{
+    return p->pPars->nThreads > 0 && p->vLevels != NULL && Mode < 2 && p->pManTim == NULL && 
+        p->nChoices == 0 && !p->pPars->fTruth && !p->pPars->fLiftLeaves && p->pPars->nGateSize == 0 &&
+        p->pPars->pFuncCost == NULL && p->pPars->pFuncUser == NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the nodes of one level assigned to one thread.]
+
+  Description [Thread k of nThreads processes the nodes k, k + nThreads, 
+  k + 2*nThreads, etc.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingLevelPart( If_Man_t * p, Vec_Int_t * vLevel, int iThread, int nThreads, int Mode, int fPreprocess, int fFirst )
+{
+    int k, nCutsMerged = 0;
+    for ( k = iThread; k < Vec_IntSize(vLevel); k += nThreads )
+        nCutsMerged += If_ObjPerformMappingAndCuts( p, If_ManObj(p, Vec_IntEntry(vLevel, k)), Mode, fPreprocess, fFirst );
+    return nCutsMerged;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Thread pool computing the cuts of one level.]
+
+  Description [The workers sleep on a condition variable until the next
+  level is posted and the main thread sleeps until all of them are done.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define IF_THR_MAX 100
+typedef struct If_ThPool_t_ If_ThPool_t;
+struct If_ThPool_t_
+{
+    If_Man_t *      p;
+    Vec_Int_t *     vLevel;       // the level being processed
+    int             nThreads;     // the number of threads
+    int             Mode;
+    int             fPreprocess;
+    int             fFirst;
+    int             iRound;       // the number of levels posted
+    int             nBusy;        // the number of threads still working
+    int             fStop;        // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;    // signals the threads about a new level
+    pthread_cond_t  CondDone;     // signals the main thread about completion
+};
+typedef struct If_ThData_t_
+{
+    If_ThPool_t *   pPool;
+    int             iThread;
+    int             nCutsMerged;
+} If_ThData_t;
+void * If_WorkerThread( void * pArg )
+{
+    If_ThData_t * pThData = (If_ThData_t *)pArg;
+    If_ThPool_t * pPool = pThData->pPool;
+    int iRound = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        pThData->nCutsMerged += If_ManPerformMappingLevelPart( pPool->p, pPool->vLevel, pThData->iThread, pPool->nThreads, 
+            pPool->Mode, pPool->fPreprocess, pPool->fFirst );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over the nodes by levels.]
+
+  Description [For each level, the nodes are prepared serially in the 
+  topological order, then their cuts are computed as a batch, possibly 
+  by several threads, then the nodes are finalized serially in the 
+  topological order. Since the cut computation of a node only reads 
+  data of the lower levels, the result does not depend on the number 
+  of threads, including the single-threaded run.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingLevels( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    Vec_Int_t * vLevel;
+    int i, k, iObj, nCutsMerged = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[IF_THR_MAX];
+    If_ThData_t ThData[IF_THR_MAX];
+    If_ThPool_t Pool, * pPool = &Pool;
+    int nThreads = Abc_MinInt( p->pPars->nThreads, IF_THR_MAX );
+    int status;
+    // start the threads
+    if ( nThreads > 1 )
+    {
+        memset( pPool, 0, sizeof(If_ThPool_t) );
+        pPool->p           = p;
+        pPool->nThreads    = nThreads;
+        pPool->Mode        = Mode;
+        pPool->fPreprocess = fPreprocess;
+        pPool->fFirst      = fFirst;
+        pthread_mutex_init( &pPool->Mutex, NULL );
+        pthread_cond_init( &pPool->CondStart, NULL );
+        pthread_cond_init( &pPool->CondDone, NULL );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            ThData[i].pPool       = pPool;
+            ThData[i].iThread     = i;
+            ThData[i].nCutsMerged = 0;
+            status = pthread_create( WorkerThread + i, NULL, If_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+    }
+#else
+    int nThreads = 1;
+#endif
+    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+    {
+        // prepare the nodes
+        Vec_IntForEachEntry( vLevel, iObj, k )
+            If_ObjPerformMappingAndStart( p, If_ManObj(p, iObj), Mode );
+        // compute the cuts (small levels are not worth waking up the threads)
+        if ( nThreads == 1 || Vec_IntSize(vLevel) < 2 * nThreads )
+            nCutsMerged += If_ManPerformMappingLevelPart( p, vLevel, 0, 1, Mode, fPreprocess, fFirst );
+#ifdef ABC_USE_PTHREADS
+        else
+        {
+            pthread_mutex_lock( &pPool->Mutex );
+            pPool->vLevel = vLevel;
+            pPool->nBusy  = nThreads;
+            pPool->iRound++;
+            pthread_cond_broadcast( &pPool->CondStart );
+            while ( pPool->nBusy > 0 )
+                pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+            pthread_mutex_unlock( &pPool->Mutex );
+        }
+#endif
+        // finalize the nodes
+        Vec_IntForEachEntry( vLevel, iObj, k )
+            If_ObjPerformMappingAndStop( p, If_ManObj(p, iObj), Mode );
+    }
+#ifdef ABC_USE_PTHREADS
+    // stop the threads
+    if ( nThreads > 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->fStop = 1;
+        pthread_cond_broadcast( &pPool->CondStart );
+        pthread_mutex_unlock( &pPool->Mutex );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pthread_join( WorkerThread[i], NULL );
+            nCutsMerged += ThData[i].nCutsMerged;
+        }
+        pthread_cond_destroy( &pPool->CondStart );
+        pthread_cond_destroy( &pPool->CondDone );
+        pthread_mutex_destroy( &pPool->Mutex );
+    }
+#endif
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -641,6 +912,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPerformMappingUseLevels( p, Mode ) )
+        If_ManPerformMappingLevels( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
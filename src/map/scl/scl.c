@@ -147,8 +147,8 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     char * pFileName;
     FILE * pFile;
-    SC_Lib * pLib;
-    int c, fDump = 0;
+    SC_Lib * pLib, * pCorner;
+    int c, i, fDump = 0;
     float Slew = 0;
     float Gain = 0;
     int nGatesMin = 0;
@@ -212,17 +212,20 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
             goto usage;
         }
     }
-    if ( argc != globalUtilOptind + 1 )
+    if ( argc < globalUtilOptind + 1 )
         goto usage;
-    // get the input file name
-    pFileName = argv[globalUtilOptind];
-    if ( (pFile = fopen( pFileName, "rb" )) == NULL )
+    // check the input file names
+    for ( i = globalUtilOptind; i < argc; i++ )
     {
-        fprintf( pAbc->Err, "Cannot open input file \"%s\". \n", pFileName );
-        return 1;
+        if ( (pFile = fopen( argv[i], "rb" )) == NULL )
+        {
+            fprintf( pAbc->Err, "Cannot open input file \"%s\". \n", argv[i] );
+            return 1;
+        }
+        fclose( pFile );
     }
-    fclose( pFile );
     // read new library
+    pFileName = argv[globalUtilOptind];
     pLib = Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
     if ( pLib == NULL )
     {
@@ -235,6 +238,21 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_SclLibFree(pLib);
         return 0;
     }
+    // read the libraries of other corners
+    for ( i = globalUtilOptind + 1; i < argc; i++ )
+    {
+        pCorner = Abc_SclReadLiberty( argv[i], fVerbose, fVeryVerbose );
+        if ( pCorner == NULL || !Abc_SclLibAddCorner( pLib, pCorner ) )
+        {
+            fprintf( pAbc->Err, "Reading corner library from file \"%s\" has failed. \n", argv[i] );
+            if ( pCorner )
+                Abc_SclLibFree( pCorner );
+            Abc_SclLibFree( pLib );
+            return 1;
+        }
+    }
+    if ( fVerbose && pLib->vCorners )
+        printf( "Timing and sizing will use %d corners.\n", 1 + Vec_PtrSize(pLib->vCorners) );
     Abc_SclLoad( pLib, (SC_Lib **)&pAbc->pLibScl );
     // convert the library if needed
     if ( fShortNames )
@@ -251,8 +269,11 @@ int Scl_CommandReadLib( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-dnvwh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_lib [-SG float] [-M num] [-dnvwh] <file> [<file2> ...]\n" );
     fprintf( pAbc->Err, "\t           reads Liberty library from file\n" );
+    fprintf( pAbc->Err, "\t           (the following files are libraries of other PVT corners,\n" );
+    fprintf( pAbc->Err, "\t           which contain the same cells and are used by stime/upsize/dnsize)\n" );
+    fprintf( pAbc->Err, "\t           (the memory-mappable image written by \"write_scl -m\" is loaded without parsing)\n" );
     fprintf( pAbc->Err, "\t-S float : the slew parameter used to generate the library [default = %.2f]\n", Slew );
     fprintf( pAbc->Err, "\t-G float : the gain parameter used to generate the library [default = %.2f]\n", Gain );
     fprintf( pAbc->Err, "\t-M num   : skip gate classes whose size is less than this [default = %d]\n", nGatesMin );
@@ -262,6 +283,7 @@ usage:
     fprintf( pAbc->Err, "\t-w       : toggle writing information about skipped gates [default = %s]\n", fVeryVerbose? "yes": "no" );
     fprintf( pAbc->Err, "\t-h       : prints the command summary\n" );
     fprintf( pAbc->Err, "\t<file>   : the name of a file to read\n" );
+    fprintf( pAbc->Err, "\t<file2>  : the name of a corner library to read\n" );
     return 1;
 }
 
@@ -536,6 +558,7 @@ int Scl_CommandReadScl( Abc_Frame_t * pAbc, int argc, char ** argv )
 usage:
     fprintf( pAbc->Err, "usage: read_scl [-dh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads extracted Liberty library from file\n" );
+    fprintf( pAbc->Err, "\t         (the memory-mappable image written by \"write_scl -m\" is used in place)\n" );
     fprintf( pAbc->Err, "\t-d     : toggle dumping the parsed library into file \"*_temp.lib\" [default = %s]\n", fDump? "yes": "no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\t<file> : the name of a file to read\n" );
@@ -557,13 +580,16 @@ int Scl_CommandWriteScl( Abc_Frame_t * pAbc, int argc, char **argv )
 {
     FILE * pFile;
     char * pFileName;
-    int c;
+    int c, fImage = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "mh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'm':
+            fImage ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -587,12 +613,16 @@ int Scl_CommandWriteScl( Abc_Frame_t * pAbc, int argc, char **argv )
     fclose( pFile );
 
     // save current library
-    Abc_SclWriteScl( pFileName, (SC_Lib *)pAbc->pLibScl );
+    if ( fImage )
+        Abc_SclWriteImage( pFileName, (SC_Lib *)pAbc->pLibScl );
+    else
+        Abc_SclWriteScl( pFileName, (SC_Lib *)pAbc->pLibScl );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_scl [-h] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_scl [-mh] <file>\n" );
     fprintf( pAbc->Err, "\t         write extracted Liberty library into file\n" );
+    fprintf( pAbc->Err, "\t-m     : toggle writing the memory-mappable image (version 2) [default = %s]\n", fImage? "yes": "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\t<file> : the name of the file to write\n" );
     return 1;
@@ -757,9 +787,10 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
     int fPrintPath    = 0;
     int fDumpStats    = 0;
     int nTreeCRatio   = 0;
+    int nThreads      = 1;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Xcapdh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "XPcapdh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -774,6 +805,17 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
                 if ( nTreeCRatio < 0 ) 
                     goto usage;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 1 ) 
+                    goto usage;
+                break;
             case 'c':
                 fUseWireLoads ^= 1;
                 break;
@@ -814,13 +856,14 @@ int Scl_CommandStime( Abc_Frame_t * pAbc, int argc, char **argv )
         return 1;
     }
 
-    Abc_SclTimePerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerform( (SC_Lib *)pAbc->pLibScl, Abc_FrameReadNtk(pAbc), nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: stime [-X num] [-capdth]\n" );
+    fprintf( pAbc->Err, "usage: stime [-XP num] [-capdth]\n" );
     fprintf( pAbc->Err, "\t         performs STA using Liberty library\n" );
     fprintf( pAbc->Err, "\t-X     : min Cout/Cave ratio for tree estimations [default = %d]\n", nTreeCRatio );
+    fprintf( pAbc->Err, "\t-P     : the number of threads for level-parallel timing analysis [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-c     : toggle using wire-loads if specified [default = %s]\n", fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-a     : display timing information for all nodes [default = %s]\n", fShowAll? "yes": "no" );
     fprintf( pAbc->Err, "\t-p     : display timing information for critical path [default = %s]\n", fPrintPath? "yes": "no" );
@@ -1382,6 +1425,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->DelayGap      =    0;
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
+    pPars->nThreads      =    1;
     pPars->BypassFreq    =    0;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
@@ -1389,7 +1433,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXBcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJWRNDGTXPBcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1490,6 +1534,17 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BuffTreeEst < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 ) 
+                goto usage;
+            break;
         case 'B':
             if ( globalUtilOptind >= argc )
             {
@@ -1548,7 +1603,7 @@ int Scl_CommandUpsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXB num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: upsize [-IJWRNDGTXPB num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively increases gate sizes on the critical path\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1559,6 +1614,7 @@ usage:
     fprintf( pAbc->Err, "\t-G <num> : delay gap during updating, in picoseconds [default = %d]\n", pPars->DelayGap );
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads for level-parallel timing analysis [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-B <num> : frequency of bypass transforms [default = %d]\n", pPars->BypassFreq );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
@@ -1593,13 +1649,14 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     pPars->DelayGap      = 1000;
     pPars->TimeOut       =    0;
     pPars->BuffTreeEst   =    0;
+    pPars->nThreads      =    1;
     pPars->fUseDept      =    1;
     pPars->fUseWireLoads =    0;
     pPars->fDumpStats    =    0;
     pPars->fVerbose      =    0;
     pPars->fVeryVerbose  =    0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXcsdvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "IJNDGTXPcsdvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1678,6 +1735,17 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
             if ( pPars->BuffTreeEst < 0 ) 
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 ) 
+                goto usage;
+            break;
         case 'c':
             pPars->fUseWireLoads ^= 1;
             break;
@@ -1725,7 +1793,7 @@ int Scl_CommandDnsize( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTX num] [-csdvwh]\n" );
+    fprintf( pAbc->Err, "usage: dnsize [-IJNDGTXP num] [-csdvwh]\n" );
     fprintf( pAbc->Err, "\t           selectively decreases gate sizes while maintaining delay\n" );
     fprintf( pAbc->Err, "\t-I <num> : the number of upsizing iterations to perform [default = %d]\n", pPars->nIters );
     fprintf( pAbc->Err, "\t-J <num> : the number of iterations without improvement to stop [default = %d]\n", pPars->nIterNoChange );
@@ -1734,6 +1802,7 @@ usage:
     fprintf( pAbc->Err, "\t-G <num> : delay gap during updating, in picoseconds [default = %d]\n", pPars->DelayGap );
     fprintf( pAbc->Err, "\t-T <num> : approximate timeout in seconds [default = %d]\n", pPars->TimeOut );
     fprintf( pAbc->Err, "\t-X <num> : ratio for buffer tree estimation [default = %d]\n", pPars->BuffTreeEst );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads for level-parallel timing analysis [default = %d]\n", pPars->nThreads );
     fprintf( pAbc->Err, "\t-c       : toggle using wire-loads if specified [default = %s]\n", pPars->fUseWireLoads? "yes": "no" );
     fprintf( pAbc->Err, "\t-s       : toggle using slack based on departure times [default = %s]\n", pPars->fUseDept? "yes": "no" );
     fprintf( pAbc->Err, "\t-d       : toggle dumping statistics into a file [default = %s]\n", pPars->fDumpStats? "yes": "no" );
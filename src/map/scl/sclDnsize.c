@@ -131,7 +131,7 @@ clk = Abc_Clock();
         Abc_SclObjSetCell( pObj, pCellOld );
         Abc_SclLoadRestore( p, pObj );
         // evaluate gain
-        dGain = Abc_SclEvalPerformLegal( p, vEvals, p->MaxDelay0 );
+        dGain = Abc_SclEvalPerformLegal( p, vEvals, p->CornerDelay0 );
         if ( dGain == -1 )
             continue;
         // save best gain
@@ -260,7 +260,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     }
 
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst, pPars->nThreads );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
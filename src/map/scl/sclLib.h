@@ -41,6 +41,8 @@ ABC_NAMESPACE_HEADER_START
 ////////////////////////////////////////////////////////////////////////
 
 #define ABC_SCL_CUR_VERSION 8
+#define ABC_SCL_IMG_MAGIC   0x324C4353     // "SCL2" -- the memory-mappable format (version 2)
+#define ABC_SCL_IMG_VERSION 2
 
 typedef enum  
 {
@@ -85,6 +87,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nThreads;         // the number of threads for timing analysis
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -230,6 +233,112 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    Vec_Ptr_t *    vCorners;       // libraries of other PVT corners (cells ordered as in this library)
+    char *         pImage;         // the image of the library (.scl version 2) whose tables are used in place
+    size_t         nImage;         // the size of the image
+    int            fImageMapped;   // the image is memory-mapped rather than read into the heap
+    void *         pImageRows;     // the row vectors of the tables pointing into the image
+};
+
+// The image is a pointer-free, relocatable copy of a normalized library. 
+// All references are byte offsets from the start of the image (0 stands 
+// for none); arrays are 8-byte aligned and stored in the native byte order.
+// The lookup tables of the library are used in place after mapping the file.
+
+typedef struct SC_ImgLib_      SC_ImgLib;
+typedef struct SC_ImgWireLoad_ SC_ImgWireLoad;
+typedef struct SC_ImgWireSel_  SC_ImgWireSel;
+typedef struct SC_ImgCell_     SC_ImgCell;
+typedef struct SC_ImgPin_      SC_ImgPin;
+typedef struct SC_ImgTimings_  SC_ImgTimings;
+typedef struct SC_ImgSurface_  SC_ImgSurface;
+
+struct SC_ImgSurface_ 
+{
+    int            nIndex0;        // the number of rows
+    int            nIndex1;        // the number of columns
+    int            Index0;         // float[nIndex0]
+    int            Index1;         // float[nIndex1]
+    int            Index0I;        // int[nIndex0]
+    int            Index1I;        // int[nIndex1]
+    int            Data;           // float[nIndex0][nIndex1]
+    int            DataI;          // int[nIndex0][nIndex1]
+    float          approx[3][6];
+};
+
+struct SC_ImgTimings_ 
+{
+    int            Name;           // the related pin
+    int            fTiming;        // the timing below is present
+    int            tsense;
+    int            Pad;
+    SC_ImgSurface  Surfs[4];       // cell rise, cell fall, rise transition, fall transition
+};
+
+struct SC_ImgPin_ 
+{
+    int            Name;
+    int            dir;
+    float          rise_cap;
+    float          fall_cap;
+    float          max_out_cap;
+    float          max_out_slew;
+    int            FuncText;       // the formula or 0
+    int            Func;           // word[nFunc] -- the truth table
+    int            nFunc;
+    int            RTimings;       // SC_ImgTimings[n_inputs] for output pins
+};
+
+struct SC_ImgCell_ 
+{
+    int            Name;
+    float          area;
+    float          leakage;
+    int            drive_strength;
+    int            n_inputs;
+    int            n_outputs;
+    int            Pins;           // SC_ImgPin[n_inputs + n_outputs]
+    int            Pad;
+};
+
+struct SC_ImgWireLoad_ 
+{
+    int            Name;
+    float          cap;
+    float          slope;
+    int            nFanouts;
+    int            Fanout;         // int[nFanouts]
+    int            Len;            // float[nFanouts]
+};
+
+struct SC_ImgWireSel_ 
+{
+    int            Name;
+    int            nAreas;
+    int            AreaFrom;       // float[nAreas]
+    int            AreaTo;         // float[nAreas]
+    int            Models;         // int[nAreas] -- the names of wire-load models
+    int            Pad;
+};
+
+struct SC_ImgLib_ 
+{
+    int            Magic;          // ABC_SCL_IMG_MAGIC
+    int            Version;        // ABC_SCL_IMG_VERSION
+    int            nBytes;         // the size of the image
+    int            Name;
+    int            DefWireLoad;
+    int            DefWireLoadSel;
+    float          default_max_out_slew;
+    int            unit_time;
+    float          unit_cap_fst;
+    int            unit_cap_snd;
+    int            nWireLoads;
+    int            WireLoads;      // SC_ImgWireLoad[nWireLoads]
+    int            nWireSels;
+    int            WireSels;       // SC_ImgWireSel[nWireSels]
+    int            nCells;
+    int            Cells;          // SC_ImgCell[nCells]
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -246,6 +355,15 @@ static inline float       SC_PairMin( SC_Pair * d )                 { return Abc
 static inline float       SC_PairAve( SC_Pair * d )                 { return 0.5 * d->rise + 0.5 * d->fall;  }
 static inline void        SC_PairDup( SC_Pair * d, SC_Pair * s )    { *d = *s;                               }
 static inline void        SC_PairMove( SC_Pair * d, SC_Pair * s )   { *d = *s; s->rise = s->fall = 0;        }
+
+static inline void *      SC_ImgPtr( SC_ImgLib * p, int Off )       { return (void *)((char *)p + Off);      }
+static inline char *      SC_ImgStr( SC_ImgLib * p, int Off )       { return Off ? (char *)p + Off : NULL;   }
+static inline int *       SC_ImgInt( SC_ImgLib * p, int Off )       { return (int *)SC_ImgPtr(p, Off);       }
+static inline float *     SC_ImgFlt( SC_ImgLib * p, int Off )       { return (float *)SC_ImgPtr(p, Off);     }
+static inline word *      SC_ImgWrd( SC_ImgLib * p, int Off )       { return (word *)SC_ImgPtr(p, Off);      }
+static inline SC_ImgCell * SC_ImgLibCell( SC_ImgLib * p, int i )    { return (SC_ImgCell *)SC_ImgPtr(p, p->Cells) + i;                }
+static inline SC_ImgPin * SC_ImgCellPin( SC_ImgLib * p, SC_ImgCell * c, int i )     { return (SC_ImgPin *)SC_ImgPtr(p, c->Pins) + i;     }
+static inline SC_ImgTimings * SC_ImgPinTimings( SC_ImgLib * p, SC_ImgPin * q, int i ) { return (SC_ImgTimings *)SC_ImgPtr(p, q->RTimings) + i; }
 static inline void        SC_PairAdd( SC_Pair * d, SC_Pair * s )    { d->rise += s->rise; d->fall += s->fall;}
 static inline int         SC_PairEqual( SC_Pair * d, SC_Pair * s )  { return d->rise == s->rise && d->fall == s->fall;                }
 static inline int         SC_PairEqualE( SC_Pair * d, SC_Pair * s, float E )  { return d->rise - s->rise < E && s->rise - d->rise < E &&  d->fall - s->fall < E && s->fall - d->fall < E;    }
@@ -436,13 +554,23 @@ static inline void Abc_SclCellFree( SC_Cell * p )
     ABC_FREE( p->pName );
     ABC_FREE( p );
 }
+extern void Abc_SclLibFreeImage( SC_Lib * p ); // sclLibScl.c
 static inline void Abc_SclLibFree( SC_Lib * p )
 {
     SC_WireLoad * pWL;
     SC_WireLoadSel * pWLS;
     SC_TableTempl * pTempl;
     SC_Cell * pCell;
+    SC_Lib * pCorner;
     int i;
+    if ( p->pImage )
+        Abc_SclLibFreeImage( p );
+    if ( p->vCorners )
+    {
+        Vec_PtrForEachEntry( SC_Lib *, p->vCorners, pCorner, i )
+            Abc_SclLibFree( pCorner );
+        Vec_PtrFree( p->vCorners );
+    }
     SC_LibForEachWireLoad( p, pWL, i )
         Abc_SclWireLoadFree( pWL );
     Vec_PtrErase( &p->vWireLoads );
@@ -739,7 +867,10 @@ extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVe
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
+extern int           Abc_SclFileIsImage( char * pFileName );
+extern SC_Lib *      Abc_SclReadImage( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
+extern void          Abc_SclWriteImage( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
@@ -748,6 +879,7 @@ extern int           Abc_SclClassCellNum( SC_Cell * pClass );
 extern void          Abc_SclShortNames( SC_Lib * p );
 extern int           Abc_SclLibClassNum( SC_Lib * pLib );
 extern void          Abc_SclLinkCells( SC_Lib * p );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
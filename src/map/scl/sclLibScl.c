@@ -25,6 +25,7 @@
 #include "misc/extra/extra.h"
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
+#include "aig/gia/gia.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -420,6 +421,8 @@ SC_Lib * Abc_SclReadFromFile( char * pFileName )
     FILE * pFile;
     Vec_Str_t * vOut;
     int nFileSize;
+    if ( Abc_SclFileIsImage( pFileName ) )
+        return Abc_SclReadImage( pFileName );
     pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
@@ -447,6 +450,385 @@ SC_Lib * Abc_SclReadFromFile( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks that the file contains the library image.]
+
+  Description [The image (.scl version 2) starts with a magic number, 
+  while the earlier format starts with a small version number.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclFileIsImage( char * pFileName )
+{
+    int Magic = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    if ( fread( &Magic, sizeof(int), 1, pFile ) != 1 )
+        Magic = 0;
+    fclose( pFile );
+    return Magic == ABC_SCL_IMG_MAGIC;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies the offsets of the library image.]
+
+  Description [Makes sure that every array and string referenced by 
+  the image is within its bounds, so that a truncated or corrupted file 
+  is rejected instead of being used in place. Returns the number of 
+  table rows in *pnRows.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclImgCheckArray( SC_ImgLib * p, int Off, int nItems, int nItemSize )
+{
+    int Align = (nItemSize % 8 == 0) ? 8 : 4;
+    return Off >= 0 && nItems >= 0 && Off % Align == 0 && (word)Off + (word)nItems * nItemSize <= (word)p->nBytes;
+}
+static inline int Abc_SclImgCheckStr( SC_ImgLib * p, int Off )
+{
+    return Off == 0 || (Off > 0 && Off < p->nBytes && memchr(SC_ImgStr(p, Off), 0, p->nBytes - Off) != NULL);
+}
+static int Abc_SclImgCheckSurface( SC_ImgLib * p, SC_ImgSurface * pS )
+{
+    int nCells = pS->nIndex0 * pS->nIndex1;
+    if ( pS->nIndex0 < 0 || pS->nIndex1 < 0 || (pS->nIndex1 > 0 && nCells / pS->nIndex1 != pS->nIndex0) )
+        return 0;
+    return Abc_SclImgCheckArray( p, pS->Index0,  pS->nIndex0, sizeof(float) ) && 
+           Abc_SclImgCheckArray( p, pS->Index1,  pS->nIndex1, sizeof(float) ) &&
+           Abc_SclImgCheckArray( p, pS->Index0I, pS->nIndex0, sizeof(int) )   && 
+           Abc_SclImgCheckArray( p, pS->Index1I, pS->nIndex1, sizeof(int) )   &&
+           Abc_SclImgCheckArray( p, pS->Data,    nCells,      sizeof(float) ) && 
+           Abc_SclImgCheckArray( p, pS->DataI,   nCells,      sizeof(int) );
+}
+static int Abc_SclImgCheck( SC_ImgLib * p, size_t nSize, int * pnRows )
+{
+    SC_ImgWireLoad * pWL;
+    SC_ImgWireSel * pWLS;
+    SC_ImgCell * pCell;
+    SC_ImgPin * pPin;
+    SC_ImgTimings * pTime;
+    int i, j, k, s;
+    *pnRows = 0;
+    if ( nSize < sizeof(SC_ImgLib) || p->Magic != ABC_SCL_IMG_MAGIC || p->Version != ABC_SCL_IMG_VERSION || (size_t)p->nBytes != nSize )
+        return 0;
+    if ( !Abc_SclImgCheckStr(p, p->Name) || !Abc_SclImgCheckStr(p, p->DefWireLoad) || !Abc_SclImgCheckStr(p, p->DefWireLoadSel) )
+        return 0;
+    if ( !Abc_SclImgCheckArray(p, p->WireLoads, p->nWireLoads, sizeof(SC_ImgWireLoad)) )
+        return 0;
+    for ( i = 0; i < p->nWireLoads; i++ )
+    {
+        pWL = (SC_ImgWireLoad *)SC_ImgPtr(p, p->WireLoads) + i;
+        if ( !Abc_SclImgCheckStr(p, pWL->Name) || !Abc_SclImgCheckArray(p, pWL->Fanout, pWL->nFanouts, sizeof(int)) || !Abc_SclImgCheckArray(p, pWL->Len, pWL->nFanouts, sizeof(float)) )
+            return 0;
+    }
+    if ( !Abc_SclImgCheckArray(p, p->WireSels, p->nWireSels, sizeof(SC_ImgWireSel)) )
+        return 0;
+    for ( i = 0; i < p->nWireSels; i++ )
+    {
+        pWLS = (SC_ImgWireSel *)SC_ImgPtr(p, p->WireSels) + i;
+        if ( !Abc_SclImgCheckStr(p, pWLS->Name) || !Abc_SclImgCheckArray(p, pWLS->AreaFrom, pWLS->nAreas, sizeof(float)) || 
+             !Abc_SclImgCheckArray(p, pWLS->AreaTo, pWLS->nAreas, sizeof(float)) || !Abc_SclImgCheckArray(p, pWLS->Models, pWLS->nAreas, sizeof(int)) )
+            return 0;
+        for ( j = 0; j < pWLS->nAreas; j++ )
+            if ( !Abc_SclImgCheckStr(p, SC_ImgInt(p, pWLS->Models)[j]) )
+                return 0;
+    }
+    if ( !Abc_SclImgCheckArray(p, p->Cells, p->nCells, sizeof(SC_ImgCell)) )
+        return 0;
+    for ( i = 0; i < p->nCells; i++ )
+    {
+        pCell = SC_ImgLibCell( p, i );
+        if ( !Abc_SclImgCheckStr(p, pCell->Name) || pCell->n_inputs < 0 || pCell->n_outputs < 0 || pCell->n_inputs > 16 ||
+             !Abc_SclImgCheckArray(p, pCell->Pins, pCell->n_inputs + pCell->n_outputs, sizeof(SC_ImgPin)) )
+            return 0;
+        for ( j = 0; j < pCell->n_inputs + pCell->n_outputs; j++ )
+        {
+            pPin = SC_ImgCellPin( p, pCell, j );
+            if ( !Abc_SclImgCheckStr(p, pPin->Name) )
+                return 0;
+            if ( j < pCell->n_inputs )
+                continue;
+            if ( !Abc_SclImgCheckStr(p, pPin->FuncText) || pPin->nFunc != Abc_Truth6WordNum(pCell->n_inputs) || 
+                 !Abc_SclImgCheckArray(p, pPin->Func, pPin->nFunc, sizeof(word)) ||
+                 !Abc_SclImgCheckArray(p, pPin->RTimings, pCell->n_inputs, sizeof(SC_ImgTimings)) )
+                return 0;
+            for ( k = 0; k < pCell->n_inputs; k++ )
+            {
+                pTime = SC_ImgPinTimings( p, pPin, k );
+                if ( !Abc_SclImgCheckStr(p, pTime->Name) )
+                    return 0;
+                if ( !pTime->fTiming )
+                    continue;
+                for ( s = 0; s < 4; s++ )
+                {
+                    if ( !Abc_SclImgCheckSurface(p, pTime->Surfs + s) )
+                        return 0;
+                    *pnRows += pTime->Surfs[s].nIndex0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading library from the memory-mapped image.]
+
+  Description [The file is mapped privately, so that its pages are 
+  shared by all processes reading the same library. The lookup tables, 
+  which make up the bulk of the library, are used in place: the vectors 
+  of each surface point into the image, while the headers of their rows 
+  come from one block allocated for the whole library. Only the small 
+  skeleton of cells, pins and timing arcs is built in the heap, so that 
+  the rest of the package can use the library as usual. Formulas are not 
+  parsed because the image contains the truth tables.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Scl_ImgRows_t_ Scl_ImgRows_t;
+struct Scl_ImgRows_t_
+{
+    void **        ppRows;         // the next free entry of row pointers
+    Vec_Flt_t *    pRows;          // the next free float row
+    Vec_Int_t *    pRowsI;         // the next free int row
+};
+static inline void Abc_SclImgFltVec( Vec_Flt_t * v, float * pArray, int nSize )
+{
+    v->nCap = v->nSize = nSize;
+    v->pArray = nSize ? pArray : NULL;
+}
+static inline void Abc_SclImgIntVec( Vec_Int_t * v, int * pArray, int nSize )
+{
+    v->nCap = v->nSize = nSize;
+    v->pArray = nSize ? pArray : NULL;
+}
+static inline void Abc_SclImgPtrVec( Vec_Ptr_t * v, void ** pArray, int nSize )
+{
+    v->nCap = v->nSize = nSize;
+    v->pArray = nSize ? pArray : NULL;
+}
+static void Abc_SclReadSurfaceImg( SC_ImgLib * pImg, SC_ImgSurface * pS, SC_Surface * p, Scl_ImgRows_t * pRows )
+{
+    int i;
+    Abc_SclImgFltVec( &p->vIndex0,  SC_ImgFlt(pImg, pS->Index0),  pS->nIndex0 );
+    Abc_SclImgFltVec( &p->vIndex1,  SC_ImgFlt(pImg, pS->Index1),  pS->nIndex1 );
+    Abc_SclImgIntVec( &p->vIndex0I, SC_ImgInt(pImg, pS->Index0I), pS->nIndex0 );
+    Abc_SclImgIntVec( &p->vIndex1I, SC_ImgInt(pImg, pS->Index1I), pS->nIndex1 );
+    Abc_SclImgPtrVec( &p->vData,  pRows->ppRows, pS->nIndex0 );  pRows->ppRows += pS->nIndex0;
+    Abc_SclImgPtrVec( &p->vDataI, pRows->ppRows, pS->nIndex0 );  pRows->ppRows += pS->nIndex0;
+    for ( i = 0; i < pS->nIndex0; i++ )
+    {
+        Abc_SclImgFltVec( pRows->pRows, SC_ImgFlt(pImg, pS->Data) + i * pS->nIndex1, pS->nIndex1 );
+        Abc_SclImgIntVec( pRows->pRowsI, SC_ImgInt(pImg, pS->DataI) + i * pS->nIndex1, pS->nIndex1 );
+        p->vData.pArray[i]  = pRows->pRows++;
+        p->vDataI.pArray[i] = pRows->pRowsI++;
+    }
+    memcpy( p->approx, pS->approx, sizeof(p->approx) );
+}
+static SC_Lib * Abc_SclReadLibraryImg( char * pContents, size_t nSize, int fMapped )
+{
+    SC_ImgLib * pImg = (SC_ImgLib *)pContents;
+    Scl_ImgRows_t Rows;
+    SC_Lib * p;
+    int i, j, k, nRows;
+    if ( !Abc_SclImgCheck( pImg, nSize, &nRows ) )
+        return NULL;
+    p = Abc_SclLibAlloc();
+    p->pImage       = pContents;
+    p->nImage       = nSize;
+    p->fImageMapped = fMapped;
+    p->pImageRows   = ABC_ALLOC( char, 2 * nRows * (sizeof(void *) + sizeof(Vec_Flt_t)) );
+    Rows.ppRows     = (void **)p->pImageRows;
+    Rows.pRows      = (Vec_Flt_t *)(Rows.ppRows + 2 * nRows);
+    Rows.pRowsI     = (Vec_Int_t *)(Rows.pRows + nRows);
+    assert( sizeof(Vec_Flt_t) == sizeof(Vec_Int_t) );
+
+    // read non-composite fields
+    p->pName                 = Abc_UtilStrsav( SC_ImgStr(pImg, pImg->Name) );
+    p->default_wire_load     = Abc_UtilStrsav( SC_ImgStr(pImg, pImg->DefWireLoad) );
+    p->default_wire_load_sel = Abc_UtilStrsav( SC_ImgStr(pImg, pImg->DefWireLoadSel) );
+    p->default_max_out_slew  = pImg->default_max_out_slew;
+    p->unit_time             = pImg->unit_time;
+    p->unit_cap_fst          = pImg->unit_cap_fst;
+    p->unit_cap_snd          = pImg->unit_cap_snd;
+
+    // read wire-load models and their selection
+    for ( i = 0; i < pImg->nWireLoads; i++ )
+    {
+        SC_ImgWireLoad * pImgWL = (SC_ImgWireLoad *)SC_ImgPtr(pImg, pImg->WireLoads) + i;
+        SC_WireLoad * pWL = Abc_SclWireLoadAlloc();
+        Vec_PtrPush( &p->vWireLoads, pWL );
+        pWL->pName = Abc_UtilStrsav( SC_ImgStr(pImg, pImgWL->Name) );
+        pWL->cap   = pImgWL->cap;
+        pWL->slope = pImgWL->slope;
+        for ( j = 0; j < pImgWL->nFanouts; j++ )
+        {
+            Vec_IntPush( &pWL->vFanout, SC_ImgInt(pImg, pImgWL->Fanout)[j] );
+            Vec_FltPush( &pWL->vLen,    SC_ImgFlt(pImg, pImgWL->Len)[j] );
+        }
+    }
+    for ( i = 0; i < pImg->nWireSels; i++ )
+    {
+        SC_ImgWireSel * pImgWLS = (SC_ImgWireSel *)SC_ImgPtr(pImg, pImg->WireSels) + i;
+        SC_WireLoadSel * pWLS = Abc_SclWireLoadSelAlloc();
+        Vec_PtrPush( &p->vWireLoadSels, pWLS );
+        pWLS->pName = Abc_UtilStrsav( SC_ImgStr(pImg, pImgWLS->Name) );
+        for ( j = 0; j < pImgWLS->nAreas; j++ )
+        {
+            Vec_FltPush( &pWLS->vAreaFrom,      SC_ImgFlt(pImg, pImgWLS->AreaFrom)[j] );
+            Vec_FltPush( &pWLS->vAreaTo,        SC_ImgFlt(pImg, pImgWLS->AreaTo)[j] );
+            Vec_PtrPush( &pWLS->vWireLoadModel, Abc_UtilStrsav(SC_ImgStr(pImg, SC_ImgInt(pImg, pImgWLS->Models)[j])) );
+        }
+    }
+
+    // read cells
+    Vec_PtrGrow( &p->vCells, pImg->nCells );
+    for ( i = 0; i < pImg->nCells; i++ )
+    {
+        SC_ImgCell * pImgCell = SC_ImgLibCell( pImg, i );
+        SC_Cell * pCell = Abc_SclCellAlloc();
+        pCell->Id = SC_LibCellNum(p);
+        Vec_PtrPush( &p->vCells, pCell );
+
+        pCell->pName          = Abc_UtilStrsav( SC_ImgStr(pImg, pImgCell->Name) );
+        pCell->area           = pImgCell->area;
+        pCell->leakage        = pImgCell->leakage;
+        pCell->drive_strength = pImgCell->drive_strength;
+        pCell->n_inputs       = pImgCell->n_inputs;
+        pCell->n_outputs      = pImgCell->n_outputs;
+        pCell->areaI          = Scl_Flt2Int(pCell->area);
+        pCell->leakageI       = Scl_Flt2Int(pCell->leakage);
+
+        Vec_PtrGrow( &pCell->vPins, pCell->n_inputs + pCell->n_outputs );
+        for ( j = 0; j < pCell->n_inputs + pCell->n_outputs; j++ )
+        {
+            SC_ImgPin * pImgPin = SC_ImgCellPin( pImg, pImgCell, j );
+            SC_Pin * pPin = Abc_SclPinAlloc();
+            Vec_PtrPush( &pCell->vPins, pPin );
+            pPin->pName = Abc_UtilStrsav( SC_ImgStr(pImg, pImgPin->Name) );
+            if ( j < pCell->n_inputs )
+            {
+                pPin->dir       = sc_dir_Input;
+                pPin->rise_cap  = pImgPin->rise_cap;
+                pPin->fall_cap  = pImgPin->fall_cap;
+                pPin->rise_capI = Scl_Flt2Int(pPin->rise_cap);
+                pPin->fall_capI = Scl_Flt2Int(pPin->fall_cap);
+                continue;
+            }
+            pPin->dir          = sc_dir_Output;
+            pPin->max_out_cap  = pImgPin->max_out_cap;
+            pPin->max_out_slew = pImgPin->max_out_slew;
+            pPin->func_text    = Abc_UtilStrsav( SC_ImgStr(pImg, pImgPin->FuncText) );
+            Vec_WrdGrow( &pPin->vFunc, pImgPin->nFunc );
+            for ( k = 0; k < pImgPin->nFunc; k++ )
+                Vec_WrdPush( &pPin->vFunc, SC_ImgWrd(pImg, pImgPin->Func)[k] );
+            // pin-to-pin timing tables of this output
+            Vec_PtrGrow( &pPin->vRTimings, pCell->n_inputs );
+            for ( k = 0; k < pCell->n_inputs; k++ )
+            {
+                SC_ImgTimings * pImgTime = SC_ImgPinTimings( pImg, pImgPin, k );
+                SC_Timings * pRTime = Abc_SclTimingsAlloc();
+                Vec_PtrPush( &pPin->vRTimings, pRTime );
+                pRTime->pName = Abc_UtilStrsav( SC_ImgStr(pImg, pImgTime->Name) );
+                if ( pImgTime->fTiming )
+                {
+                    SC_Timing * pTime = Abc_SclTimingAlloc();
+                    Vec_PtrPush( &pRTime->vTimings, pTime );
+                    pTime->tsense = (SC_TSense)pImgTime->tsense;
+                    Abc_SclReadSurfaceImg( pImg, pImgTime->Surfs + 0, &pTime->pCellRise,  &Rows );
+                    Abc_SclReadSurfaceImg( pImg, pImgTime->Surfs + 1, &pTime->pCellFall,  &Rows );
+                    Abc_SclReadSurfaceImg( pImg, pImgTime->Surfs + 2, &pTime->pRiseTrans, &Rows );
+                    Abc_SclReadSurfaceImg( pImg, pImgTime->Surfs + 3, &pTime->pFallTrans, &Rows );
+                }
+            }
+        }
+    }
+    assert( Rows.ppRows == (void **)p->pImageRows + 2 * nRows );
+    return p;
+}
+SC_Lib * Abc_SclReadImage( char * pFileName )
+{
+    SC_Lib * p;
+    size_t nSize;
+    int fMapped;
+    char * pContents = Gia_FileMap( pFileName, &nSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    p = Abc_SclReadLibraryImg( pContents, nSize, fMapped );
+    if ( p == NULL )
+    {
+        Abc_Print( -1, "The SCL file \"%s\" is corrupted or was written on a machine with a different byte order.\n", pFileName );
+        Gia_FileUnmap( pContents, nSize, fMapped );
+        return NULL;
+    }
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclHashCells( p );
+    Abc_SclLinkCells( p );
+    Abc_SclLibNormalize( p );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the image of the library.]
+
+  Description [Detaches the vectors pointing into the image, so that 
+  the library can be freed as usual, and unmaps the image.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclSurfaceDetach( SC_Surface * p )
+{
+    memset( &p->vIndex0,  0, sizeof(Vec_Flt_t) );
+    memset( &p->vIndex1,  0, sizeof(Vec_Flt_t) );
+    memset( &p->vIndex0I, 0, sizeof(Vec_Int_t) );
+    memset( &p->vIndex1I, 0, sizeof(Vec_Int_t) );
+    memset( &p->vData,    0, sizeof(Vec_Ptr_t) );
+    memset( &p->vDataI,   0, sizeof(Vec_Ptr_t) );
+}
+void Abc_SclLibFreeImage( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    int i, j, k, n;
+    if ( p->pImage == NULL )
+        return;
+    SC_LibForEachCell( p, pCell, i )
+        SC_CellForEachPinOut( pCell, pPin, j )
+            SC_PinForEachRTiming( pPin, pRTime, k )
+                Vec_PtrForEachEntry( SC_Timing *, &pRTime->vTimings, pTime, n )
+                {
+                    Abc_SclSurfaceDetach( &pTime->pCellRise );
+                    Abc_SclSurfaceDetach( &pTime->pCellFall );
+                    Abc_SclSurfaceDetach( &pTime->pRiseTrans );
+                    Abc_SclSurfaceDetach( &pTime->pFallTrans );
+                }
+    Gia_FileUnmap( p->pImage, p->nImage, p->fImageMapped );
+    ABC_FREE( p->pImageRows );
+    p->pImage = NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writing library into file.]
@@ -629,6 +1011,206 @@ void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
     Vec_StrFree( vOut );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writing library into the memory-mappable image.]
+
+  Description [The image is built in a byte vector, which may be 
+  reallocated while it grows, so its records are filled in local 
+  variables and copied into place after their offsets are known.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclImgAlloc( Vec_Str_t * vOut, int nBytes )
+{
+    int Off = Vec_StrSize(vOut);
+    Vec_StrFillExtra( vOut, Off + ((nBytes + 7) & ~7), 0 );
+    return Off;
+}
+static int Abc_SclImgData( Vec_Str_t * vOut, void * pData, int nBytes )
+{
+    int Off = Abc_SclImgAlloc( vOut, nBytes );
+    if ( nBytes )
+        memcpy( Vec_StrArray(vOut) + Off, pData, (size_t)nBytes );
+    return Off;
+}
+static int Abc_SclImgStr( Vec_Str_t * vOut, char * pStr )
+{
+    return pStr ? Abc_SclImgData( vOut, pStr, (int)strlen(pStr) + 1 ) : 0;
+}
+static inline void Abc_SclImgPut( Vec_Str_t * vOut, int Off, void * pData, int nBytes )
+{
+    memcpy( Vec_StrArray(vOut) + Off, pData, (size_t)nBytes );
+}
+static void Abc_SclWriteSurfaceImg( Vec_Str_t * vOut, SC_Surface * p, SC_ImgSurface * pS )
+{
+    Vec_Flt_t * vVec;
+    float Entry;
+    int i, k, * pInts;
+    pS->nIndex0 = Vec_FltSize(&p->vIndex0);
+    pS->nIndex1 = Vec_FltSize(&p->vIndex1);
+    pS->Index0  = Abc_SclImgData( vOut, Vec_FltArray(&p->vIndex0), sizeof(float) * pS->nIndex0 );
+    pS->Index1  = Abc_SclImgData( vOut, Vec_FltArray(&p->vIndex1), sizeof(float) * pS->nIndex1 );
+    pS->Data    = Abc_SclImgAlloc( vOut, sizeof(float) * pS->nIndex0 * pS->nIndex1 );
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vVec, i )
+        Abc_SclImgPut( vOut, pS->Data + sizeof(float) * i * pS->nIndex1, Vec_FltArray(vVec), sizeof(float) * Vec_FltSize(vVec) );
+    // integer tables are derived from the floats, as done when reading the earlier format
+    pS->Index0I = Abc_SclImgAlloc( vOut, sizeof(int) * pS->nIndex0 );
+    pS->Index1I = Abc_SclImgAlloc( vOut, sizeof(int) * pS->nIndex1 );
+    pS->DataI   = Abc_SclImgAlloc( vOut, sizeof(int) * pS->nIndex0 * pS->nIndex1 );
+    pInts = (int *)(Vec_StrArray(vOut) + pS->Index0I);
+    Vec_FltForEachEntry( &p->vIndex0, Entry, i )
+        pInts[i] = Scl_Flt2Int(Entry);
+    pInts = (int *)(Vec_StrArray(vOut) + pS->Index1I);
+    Vec_FltForEachEntry( &p->vIndex1, Entry, i )
+        pInts[i] = Scl_Flt2Int(Entry);
+    pInts = (int *)(Vec_StrArray(vOut) + pS->DataI);
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vVec, i )
+        Vec_FltForEachEntry( vVec, Entry, k )
+            pInts[i * pS->nIndex1 + k] = Scl_Flt2Int(Entry);
+    memcpy( pS->approx, p->approx, sizeof(p->approx) );
+}
+static void Abc_SclWriteLibraryImg( Vec_Str_t * vOut, SC_Lib * p )
+{
+    SC_ImgLib Lib;
+    SC_WireLoad * pWL;
+    SC_WireLoadSel * pWLS;
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pRTime;
+    int i, j, k, iCell = 0;
+
+    memset( &Lib, 0, sizeof(SC_ImgLib) );
+    Abc_SclImgAlloc( vOut, sizeof(SC_ImgLib) );
+    Lib.Magic                = ABC_SCL_IMG_MAGIC;
+    Lib.Version              = ABC_SCL_IMG_VERSION;
+    Lib.Name                 = Abc_SclImgStr( vOut, p->pName );
+    Lib.DefWireLoad          = Abc_SclImgStr( vOut, p->default_wire_load );
+    Lib.DefWireLoadSel       = Abc_SclImgStr( vOut, p->default_wire_load_sel );
+    Lib.default_max_out_slew = p->default_max_out_slew;
+    Lib.unit_time            = p->unit_time;
+    Lib.unit_cap_fst         = p->unit_cap_fst;
+    Lib.unit_cap_snd         = p->unit_cap_snd;
+
+    // write wire-load models and their selection
+    Lib.nWireLoads = Vec_PtrSize(&p->vWireLoads);
+    Lib.WireLoads  = Abc_SclImgAlloc( vOut, sizeof(SC_ImgWireLoad) * Lib.nWireLoads );
+    SC_LibForEachWireLoad( p, pWL, i )
+    {
+        SC_ImgWireLoad WL;
+        memset( &WL, 0, sizeof(SC_ImgWireLoad) );
+        WL.Name     = Abc_SclImgStr( vOut, pWL->pName );
+        WL.cap      = pWL->cap;
+        WL.slope    = pWL->slope;
+        WL.nFanouts = Vec_IntSize(&pWL->vFanout);
+        WL.Fanout   = Abc_SclImgData( vOut, Vec_IntArray(&pWL->vFanout), sizeof(int) * WL.nFanouts );
+        WL.Len      = Abc_SclImgData( vOut, Vec_FltArray(&pWL->vLen), sizeof(float) * WL.nFanouts );
+        Abc_SclImgPut( vOut, Lib.WireLoads + sizeof(SC_ImgWireLoad) * i, &WL, sizeof(SC_ImgWireLoad) );
+    }
+    Lib.nWireSels = Vec_PtrSize(&p->vWireLoadSels);
+    Lib.WireSels  = Abc_SclImgAlloc( vOut, sizeof(SC_ImgWireSel) * Lib.nWireSels );
+    SC_LibForEachWireLoadSel( p, pWLS, i )
+    {
+        SC_ImgWireSel WLS;
+        memset( &WLS, 0, sizeof(SC_ImgWireSel) );
+        WLS.Name     = Abc_SclImgStr( vOut, pWLS->pName );
+        WLS.nAreas   = Vec_FltSize(&pWLS->vAreaFrom);
+        WLS.AreaFrom = Abc_SclImgData( vOut, Vec_FltArray(&pWLS->vAreaFrom), sizeof(float) * WLS.nAreas );
+        WLS.AreaTo   = Abc_SclImgData( vOut, Vec_FltArray(&pWLS->vAreaTo), sizeof(float) * WLS.nAreas );
+        WLS.Models   = Abc_SclImgAlloc( vOut, sizeof(int) * WLS.nAreas );
+        for ( j = 0; j < WLS.nAreas; j++ )
+        {
+            int Model = Abc_SclImgStr( vOut, (char *)Vec_PtrEntry(&pWLS->vWireLoadModel, j) );
+            Abc_SclImgPut( vOut, WLS.Models + sizeof(int) * j, &Model, sizeof(int) );
+        }
+        Abc_SclImgPut( vOut, Lib.WireSels + sizeof(SC_ImgWireSel) * i, &WLS, sizeof(SC_ImgWireSel) );
+    }
+
+    // write cells, skipping those that cannot be used (as in the earlier format)
+    SC_LibForEachCell( p, pCell, i )
+        if ( !(pCell->seq || pCell->unsupp) )
+            Lib.nCells++;
+    Lib.Cells = Abc_SclImgAlloc( vOut, sizeof(SC_ImgCell) * Lib.nCells );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        SC_ImgCell Cell;
+        if ( pCell->seq || pCell->unsupp )
+            continue;
+        memset( &Cell, 0, sizeof(SC_ImgCell) );
+        Cell.Name           = Abc_SclImgStr( vOut, pCell->pName );
+        Cell.area           = pCell->area;
+        Cell.leakage        = pCell->leakage;
+        Cell.drive_strength = pCell->drive_strength;
+        Cell.n_inputs       = pCell->n_inputs;
+        Cell.n_outputs      = pCell->n_outputs;
+        Cell.Pins           = Abc_SclImgAlloc( vOut, sizeof(SC_ImgPin) * Vec_PtrSize(&pCell->vPins) );
+        SC_CellForEachPin( pCell, pPin, j )
+        {
+            SC_ImgPin Pin;
+            memset( &Pin, 0, sizeof(SC_ImgPin) );
+            Pin.Name         = Abc_SclImgStr( vOut, pPin->pName );
+            Pin.dir          = (int)pPin->dir;
+            Pin.rise_cap     = pPin->rise_cap;
+            Pin.fall_cap     = pPin->fall_cap;
+            Pin.max_out_cap  = pPin->max_out_cap;
+            Pin.max_out_slew = pPin->max_out_slew;
+            if ( j >= pCell->n_inputs )
+            {
+                assert( pPin->dir == sc_dir_Output );
+                assert( Vec_WrdSize(&pPin->vFunc) == Abc_Truth6WordNum(pCell->n_inputs) );
+                assert( Vec_PtrSize(&pPin->vRTimings) == pCell->n_inputs );
+                Pin.FuncText = Abc_SclImgStr( vOut, (pPin->func_text && pPin->func_text[0]) ? pPin->func_text : NULL );
+                Pin.nFunc    = Vec_WrdSize(&pPin->vFunc);
+                Pin.Func     = Abc_SclImgData( vOut, Vec_WrdArray(&pPin->vFunc), sizeof(word) * Pin.nFunc );
+                Pin.RTimings = Abc_SclImgAlloc( vOut, sizeof(SC_ImgTimings) * pCell->n_inputs );
+                SC_PinForEachRTiming( pPin, pRTime, k )
+                {
+                    SC_ImgTimings Time;
+                    memset( &Time, 0, sizeof(SC_ImgTimings) );
+                    Time.Name = Abc_SclImgStr( vOut, pRTime->pName );
+                    assert( Vec_PtrSize(&pRTime->vTimings) <= 1 );
+                    if ( Vec_PtrSize(&pRTime->vTimings) == 1 )
+                    {
+                        SC_Timing * pTime = (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+                        Time.fTiming = 1;
+                        Time.tsense  = (int)pTime->tsense;
+                        Abc_SclWriteSurfaceImg( vOut, &pTime->pCellRise,  Time.Surfs + 0 );
+                        Abc_SclWriteSurfaceImg( vOut, &pTime->pCellFall,  Time.Surfs + 1 );
+                        Abc_SclWriteSurfaceImg( vOut, &pTime->pRiseTrans, Time.Surfs + 2 );
+                        Abc_SclWriteSurfaceImg( vOut, &pTime->pFallTrans, Time.Surfs + 3 );
+                    }
+                    Abc_SclImgPut( vOut, Pin.RTimings + sizeof(SC_ImgTimings) * k, &Time, sizeof(SC_ImgTimings) );
+                }
+            }
+            else
+                assert( pPin->dir == sc_dir_Input );
+            Abc_SclImgPut( vOut, Cell.Pins + sizeof(SC_ImgPin) * j, &Pin, sizeof(SC_ImgPin) );
+        }
+        Abc_SclImgPut( vOut, Lib.Cells + sizeof(SC_ImgCell) * iCell++, &Cell, sizeof(SC_ImgCell) );
+    }
+    assert( iCell == Lib.nCells );
+    Lib.nBytes = Vec_StrSize(vOut);
+    Abc_SclImgPut( vOut, 0, &Lib, sizeof(SC_ImgLib) );
+}
+void Abc_SclWriteImage( char * pFileName, SC_Lib * p )
+{
+    Vec_Str_t * vOut = Vec_StrAlloc( 1 << 16 );
+    FILE * pFile;
+    Abc_SclWriteLibraryImg( vOut, p );
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+    else
+    {
+        fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile );
+        fclose( pFile );
+    }
+    Vec_StrFree( vOut );
+}
+
 
 /**Function*************************************************************
 
@@ -316,6 +316,81 @@ void Abc_SclLinkCells( SC_Lib * p )
     Vec_PtrFree( vList );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Attaches the library of another PVT corner.]
+
+  Description [The corner library should contain all cells of this library
+  with the same pins. Its cells are reordered to have the same IDs as the
+  cells with the same names in this library, so that the timing managers 
+  of all corners can share the gate assignment of the network. The cells 
+  not found in this library are placed last. Returns 0 if the libraries 
+  do not match; in this case, the corner library is not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    Vec_Ptr_t * vCells;
+    SC_Cell * pCell, * pCellC;
+    SC_Pin * pPin;
+    int i, k, iCell, RetValue = 1;
+    vCells = Vec_PtrAlloc( SC_LibCellNum(pCorner) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        pCellC = iCell == -1 ? NULL : SC_LibCell( pCorner, iCell );
+        if ( pCellC == NULL || pCellC->Id == -1 )
+        {
+            Abc_Print( -1, "Cell \"%s\" is not found in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            RetValue = 0;
+            break;
+        }
+        if ( pCellC->n_inputs != pCell->n_inputs || pCellC->n_outputs != pCell->n_outputs )
+        {
+            Abc_Print( -1, "Cell \"%s\" has different pins in the corner library \"%s\".\n", pCell->pName, pCorner->pName );
+            RetValue = 0;
+            break;
+        }
+        SC_CellForEachPin( pCell, pPin, k )
+            if ( strcmp(pPin->pName, SC_CellPinName(pCellC, k)) )
+                break;
+        if ( k < Vec_PtrSize(&pCell->vPins) )
+        {
+            Abc_Print( -1, "Pin \"%s\" of cell \"%s\" is not in the same position in the corner library \"%s\".\n", pPin->pName, pCell->pName, pCorner->pName );
+            RetValue = 0;
+            break;
+        }
+        Vec_PtrPush( vCells, pCellC );
+        pCellC->Id = -1;
+    }
+    SC_LibForEachCell( pCorner, pCellC, i )
+        if ( pCellC->Id == -1 )
+            pCellC->Id = i;
+        else if ( RetValue )
+            Vec_PtrPush( vCells, pCellC );
+    if ( RetValue )
+    {
+        assert( Vec_PtrSize(vCells) == SC_LibCellNum(pCorner) );
+        Vec_PtrForEachEntry( SC_Cell *, vCells, pCellC, i )
+        {
+            Vec_PtrWriteEntry( &pCorner->vCells, i, pCellC );
+            pCellC->Id = i;
+        }
+        ABC_FREE( pCorner->pBins );
+        pCorner->nBins = 0;
+        Abc_SclHashCells( pCorner );
+        if ( p->vCorners == NULL )
+            p->vCorners = Vec_PtrAlloc( 4 );
+        Vec_PtrPush( p->vCorners, pCorner );
+    }
+    Vec_PtrFree( vCells );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the largest inverter.]
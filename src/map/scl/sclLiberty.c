@@ -1678,6 +1678,18 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    // the memory-mappable image is used without parsing
+    if ( Abc_SclFileIsImage( pFileName ) )
+    {
+        abctime clk = Abc_Clock();
+        pLib = Abc_SclReadImage( pFileName );
+        if ( pLib && fVerbose )
+        {
+            printf( "Library \"%s\" from image \"%s\" has %d cells.  ", pLib->pName, pFileName, SC_LibCellNum(pLib) );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        return pLib;
+    }
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
         return NULL;
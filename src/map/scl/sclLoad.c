@@ -119,7 +119,7 @@ void Abc_SclComputeLoad( SC_Man * p )
     // add cell load
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
     {
-        SC_Cell * pCell = Abc_SclObjCell( pObj );
+        SC_Cell * pCell = Abc_SclManObjCell( p, pObj );
         Abc_ObjForEachFanin( pObj, pFanin, k )
         {
             SC_Pair * pLoad = Abc_SclObjLoad( p, pFanin );
@@ -191,7 +191,8 @@ void Abc_SclComputeLoad( SC_Man * p )
 
   Synopsis    [Updates load of the node's fanins.]
 
-  Description []
+  Description [The cells belong to the library of this manager. The loads
+  are also updated in the managers of other corners.]
                
   SideEffects []
 
@@ -201,6 +202,7 @@ void Abc_SclComputeLoad( SC_Man * p )
 void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew )
 {
     Abc_Obj_t * pFanin;
+    SC_Man * pCorner;
     int k;
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -210,15 +212,18 @@ void Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell *
         pLoad->rise += pPinNew->rise_cap - pPinOld->rise_cap;
         pLoad->fall += pPinNew->fall_cap - pPinOld->fall_cap;
     }
+    Abc_SclManForEachCornerStart( p, pCorner, k, 1 )
+        Abc_SclUpdateLoad( pCorner, pObj, SC_LibCell(pCorner->pLib, pOld->Id), SC_LibCell(pCorner->pLib, pNew->Id) );
 }
 void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout )
 {
+    SC_Man * pCorner;
     SC_Pin * pPin;
     SC_Pair * pLoad;
-    int iFanin = Abc_NodeFindFanin( pFanout, pBuffer );
+    int i, iFanin = Abc_NodeFindFanin( pFanout, pBuffer );
     assert( iFanin >= 0 );
     assert( Abc_ObjFaninNum(pBuffer) == 1 );
-    pPin = SC_CellPin( Abc_SclObjCell(pFanout), iFanin );
+    pPin = SC_CellPin( Abc_SclManObjCell(p, pFanout), iFanin );
     // update load of the buffer
     pLoad = Abc_SclObjLoad( p, pBuffer );
     pLoad->rise -= pPin->rise_cap;
@@ -227,6 +232,8 @@ void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanou
     pLoad = Abc_SclObjLoad( p, Abc_ObjFanin0(pBuffer) );
     pLoad->rise += pPin->rise_cap;
     pLoad->fall += pPin->fall_cap;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclUpdateLoadSplit( pCorner, pBuffer, pFanout );
 }
 
 ////////////////////////////////////////////////////////////////////////
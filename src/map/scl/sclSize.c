@@ -27,6 +27,17 @@
 #include <windows.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -172,6 +183,12 @@ void Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath )
     Abc_Print( 1, "(%5.1f %%)   ",         100.0 * Abc_SclCountNearCriticalNodes(p) / Abc_NtkNodeNum(p->pNtk) );
     Abc_Print( 1, "            \n" );
 #endif
+    if ( p->vCorners )
+    {
+        SC_Man * pCorner;
+        Abc_SclManForEachCorner( p, pCorner, i )
+            Abc_Print( 1, "Corner %d:  Library = \"%s\"  Delay =%9.2f ps\n", i, pCorner->pLib->pName, Abc_SclReadCornerDelay(pCorner) );
+    }
 
     if ( fShowAll )
     {
@@ -286,7 +303,7 @@ static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
     {
         if ( Abc_ObjIsCo(pFanout) || Abc_ObjIsLatch(pFanout) )
             continue;
-        pTime = Scl_CellPinTime( Abc_SclObjCell(pFanout), Abc_NodeFindFanin(pFanout, pObj) );
+        pTime = Scl_CellPinTime( Abc_SclManObjCell(p, pFanout), Abc_NodeFindFanin(pFanout, pObj) );
         Abc_SclDeptFanin( p, pTime, pFanout, pObj );
     }
 }
@@ -305,11 +322,11 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+static inline int Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
-    int k;
+    int k, fEst = 0;
     SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
     float LoadRise = pLoad->rise;
     float LoadFall = pLoad->fall;
@@ -321,7 +338,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     {
         assert( !fDept );
         Abc_SclTimeCi( p, pObj );
-        return;
+        return 0;
     }
     if ( Abc_ObjIsCo(pObj) )
     {
@@ -331,7 +348,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
             Vec_QueUpdate( p->vQue, pObj->iData );
         }
-        return;
+        return 0;
     }
     assert( Abc_ObjIsNode(pObj) );
 //    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
@@ -348,10 +365,10 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
+        fEst = 1;
     }
     // get the library cell
-    pCell = Abc_SclObjCell( pObj );
+    pCell = Abc_SclManObjCell( p, pObj );
     // compute for each fanin
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -379,12 +396,20 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pArrOut->fall += EstDelta;
         }
     }
+    return fEst;
+}
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    p->nEstNodes += Abc_SclTimeNodeInt( p, pObj, fDept );
 }
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
     int fVerbose = 0;
+    SC_Man * pCorner;
     Abc_Obj_t * pObj;
     int i;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclTimeCone( pCorner, vCone );
     Abc_SclConeClean( p, vCone );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -397,18 +422,247 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+/**Function*************************************************************
+
+  Synopsis    [Level-parallel timing analysis.]
+
+  Description [Arrival times and slews of the nodes on the same level 
+  depend only on the lower levels, so they are computed concurrently.
+  In the departure pass, each object collects its departure time from 
+  its fanouts (rather than each node pushing its departure time to its 
+  fanins as in Abc_SclTimeNode), so that the objects on the same level 
+  write only their own data. Since the maximum of the same values is
+  taken, the result is identical to the serial computation and does 
+  not depend on the number of threads. CIs and COs are processed 
+  serially because COs update the shared queue of output times.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclTimeNtkUseMt( SC_Man * p )
+{
+#ifdef ABC_USE_PTHREADS
+    return p->nThreads > 1;
+#else
+    return 0;
+#endif
+}
+static inline int Abc_SclDeptObjGather( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pDepIn = Abc_SclObjDept( p, pObj );
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    SC_Pair Load, DepOut;
+    SC_Cell * pCell;
+    Abc_Obj_t * pFanout;
+    float Value;
+    int i, k;
+    SC_PairClean( pDepIn );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        Load   = *Abc_SclObjLoad( p, pFanout );
+        DepOut = *Abc_SclObjDept( p, pFanout );
+        Value  = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = Load.fall = p->EstLoadAve * p->EstLoadMax;
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+        }
+        // a fanout listed several times contributes the same values again
+        pCell = Abc_SclManObjCell( p, pFanout );
+        for ( k = 0; k < Abc_ObjFaninNum(pFanout); k++ )
+            if ( Abc_ObjFanin(pFanout, k) == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(pCell, k), pDepIn, pSlewIn, &Load, &DepOut );
+    }
+    return Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 && p->EstLoadMax && Abc_SclObjLoadValue(p, pObj) > 1;
+}
+static inline int Abc_SclTimeObjMt( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    return fDept ? Abc_SclDeptObjGather( p, pObj ) : Abc_SclTimeNodeInt( p, pObj, 0 );
+}
+// levelizes CIs and internal nodes; returns NULL if the nodes are not in a topological order
+Vec_Wec_t * Abc_SclTimeNtkLevelize( SC_Man * p )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vObjLevels = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level, LevelMax = 0;
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            if ( Abc_ObjId(pFanin) >= Abc_ObjId(pObj) )
+            {
+                Vec_IntFree( vObjLevels );
+                return NULL;
+            }
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vObjLevels, Abc_ObjId(pFanin)) );
+        }
+        Vec_IntWriteEntry( vObjLevels, Abc_ObjId(pObj), Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    vLevels = Vec_WecStart( LevelMax + 1 );
+    Abc_NtkForEachObj( p->pNtk, pObj, i )
+        if ( Abc_ObjIsCi(pObj) || Abc_ObjIsNode(pObj) )
+            Vec_WecPush( vLevels, Vec_IntEntry(vObjLevels, i), i );
+    Vec_IntFree( vObjLevels );
+    return vLevels;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+#define SCL_THR_MAX 100
+typedef struct Scl_ThPool_t_
+{
+    SC_Man *        p;
+    Vec_Int_t *     vLevel;     // the level being processed
+    int             nThreads;   // the number of threads
+    int             fDept;      // computing departure times
+    int             iRound;     // the number of levels posted
+    int             nBusy;      // the number of threads still working
+    int             fStop;      // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;  // signals the threads about a new level
+    pthread_cond_t  CondDone;   // signals the main thread about completion
+} Scl_ThPool_t;
+typedef struct Scl_ThData_t_
+{
+    Scl_ThPool_t * pPool;
+    int            iThread;
+    int            nEstNodes;
+} Scl_ThData_t;
+void * Scl_WorkerThread( void * pArg )
+{
+    Scl_ThData_t * pThData = (Scl_ThData_t *)pArg;
+    Scl_ThPool_t * pPool = pThData->pPool;
+    int k, iRound = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        for ( k = pThData->iThread; k < Vec_IntSize(pPool->vLevel); k += pPool->nThreads )
+            pThData->nEstNodes += Abc_SclTimeObjMt( pPool->p, Abc_NtkObj(pPool->p->pNtk, Vec_IntEntry(pPool->vLevel, k)), pPool->fDept );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+void Abc_SclTimeNtkLevelsMt( SC_Man * p, Vec_Wec_t * vLevels, int fDept )
+{
+    pthread_t WorkerThread[SCL_THR_MAX];
+    Scl_ThData_t ThData[SCL_THR_MAX];
+    Scl_ThPool_t Pool, * pPool = &Pool;
+    Vec_Int_t * vLevel;
+    int nThreads = Abc_MinInt( p->nThreads, SCL_THR_MAX );
+    int i, k, n, iObj, status;
+    // start the threads
+    memset( pPool, 0, sizeof(Scl_ThPool_t) );
+    pPool->p        = p;
+    pPool->nThreads = nThreads;
+    pPool->fDept    = fDept;
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pPool     = pPool;
+        ThData[i].iThread   = i;
+        ThData[i].nEstNodes = 0;
+        status = pthread_create( WorkerThread + i, NULL, Scl_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( n = 0; n < Vec_WecSize(vLevels); n++ )
+    {
+        // departure times are computed in the reverse order
+        vLevel = Vec_WecEntry( vLevels, fDept ? Vec_WecSize(vLevels) - 1 - n : n );
+        // arrival times of CIs are computed by the caller
+        if ( !fDept && n == 0 )
+            continue;
+        // small levels are not worth waking up the threads
+        if ( Vec_IntSize(vLevel) < 16 * nThreads )
+        {
+            Vec_IntForEachEntry( vLevel, iObj, k )
+                ThData[0].nEstNodes += Abc_SclTimeObjMt( p, Abc_NtkObj(p->pNtk, iObj), fDept );
+            continue;
+        }
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->vLevel = vLevel;
+        pPool->nBusy  = nThreads;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        p->nEstNodes += ThData[i].nEstNodes;
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+}
+
+#else // pthreads are not used
+
+void Abc_SclTimeNtkLevelsMt( SC_Man * p, Vec_Wec_t * vLevels, int fDept ) {}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Timing analysis of the whole network.]
+
+  Description [When the library has several corners, the other corners 
+  are analyzed first, and the returned delay is the worst across the 
+  corners.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
+    Vec_Wec_t * vLevels = Abc_SclTimeNtkUseMt(p) ? Abc_SclTimeNtkLevelize(p) : NULL;
+    SC_Man * pCorner;
     Abc_Obj_t * pObj;
     float D;
     int i;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclTimeNtkRecompute( pCorner, NULL, &pCorner->MaxDelay, fReverse, DUser );
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( vLevels )
+        Abc_SclTimeNtkLevelsMt( p, vLevels, 0 );
+    else
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -421,9 +675,15 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( fReverse )
     {
         p->nEstNodes = 0;
-        Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
-            Abc_SclTimeNode( p, pObj, 1 );
+        if ( vLevels )
+            Abc_SclTimeNtkLevelsMt( p, vLevels, 1 );
+        else
+        {
+            Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
+                Abc_SclTimeNode( p, pObj, 1 );
+        }
     }
+    Vec_WecFreeP( &vLevels );
 }
 
 /**Function*************************************************************
@@ -539,10 +799,13 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
 }
 int Abc_SclTimeIncUpdate( SC_Man * p )
 {
+    SC_Man * pCorner;
     Abc_Obj_t * pObj;
     int i, RetValue;
     if ( Vec_IntSize(p->vChanged) == 0 )
         return 0;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclTimeIncUpdate( pCorner );
 //    Abc_SclTimeIncCheckLevel( p->pNtk );
     Abc_NtkForEachObjVec( p->vChanged, p->pNtk, pObj, i )
     {
@@ -561,7 +824,10 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
 }
 void Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj )
 {
-    Vec_IntPush( p->vChanged, Abc_ObjId(pObj) );
+    SC_Man * pCorner;
+    int i;
+    Abc_SclManForEachCorner( p, pCorner, i )
+        Vec_IntPush( pCorner->vChanged, Abc_ObjId(pObj) );
 }
 void Abc_SclTimeIncUpdateLevel_rec( Abc_Obj_t * pObj )
 {
@@ -619,6 +885,42 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
     }
 }
  
+/**Function*************************************************************
+
+  Synopsis    [Prepare timing manager of another corner.]
+
+  Description [The manager shares the network and the gate assignment
+  with the main manager and uses the same boundary conditions.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static SC_Man * Abc_SclManStartCorner( SC_Man * p, SC_Lib * pLib )
+{
+    SC_Man * pCorner = Abc_SclManAlloc( pLib, p->pNtk );
+    SC_WireLoad * pWL;
+    Abc_Obj_t * pObj;
+    int i;
+    pCorner->nThreads   = p->nThreads;
+    pCorner->EstLoadMax = p->EstLoadMax;
+    pCorner->EstLinear  = p->EstLinear;
+    Abc_NtkForEachPo( p->pNtk, pObj, i )
+        *Abc_SclObjLoad( pCorner, pObj ) = *Abc_SclObjLoad( p, pObj );
+    if ( p->pPiDrive )
+        pCorner->pPiDrive = SC_LibCell( pLib, p->pPiDrive->Id );
+    // use the wire load model with the same name, if present
+    if ( p->pWLoadUsed )
+    {
+        pCorner->pWLoadUsed = p->pWLoadUsed;
+        SC_LibForEachWireLoad( pLib, pWL, i )
+            if ( !strcmp(pWL->pName, p->pWLoadUsed->pName) )
+                pCorner->pWLoadUsed = pWL;
+    }
+    return pCorner;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prepare timing manager.]
@@ -630,9 +932,13 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    SC_Man * pCorner;
+    SC_Lib * pLibCorner;
+    int i;
+    p->nThreads = nThreads;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -651,9 +957,23 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
         else
             p->pWLoadUsed = Abc_SclFetchWireLoadModel( pLib, pNtk->pWLoadUsed );
     }
+    if ( pLib->vCorners )
+    {
+        p->vCorners = Vec_PtrAlloc( Vec_PtrSize(pLib->vCorners) );
+        Vec_PtrForEachEntry( SC_Lib *, pLib->vCorners, pLibCorner, i )
+            Vec_PtrPush( p->vCorners, Abc_SclManStartCorner(p, pLibCorner) );
+    }
     Abc_SclTimeNtkRecompute( p, &p->SumArea0, &p->MaxDelay0, fDept, DUser );
     p->SumArea  = p->SumArea0;
     p->MaxDelay = p->MaxDelay0;
+    Abc_SclManForEachCorner( p, pCorner, i )
+    {
+        pCorner->CornerDelay0 = Abc_SclReadCornerDelay( pCorner );
+        if ( fDept && DUser > 0 && pCorner->CornerDelay0 < DUser )
+            pCorner->CornerDelay0 = DUser;
+        if ( pCorner != p )
+            pCorner->MaxDelay0 = pCorner->CornerDelay0;
+    }
     return p;
 }
 
@@ -668,10 +988,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nThreads );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +1009,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +1219,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
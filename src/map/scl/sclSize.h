@@ -82,11 +82,15 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    int            nThreads;      // the number of threads for full timing analysis
+    // other corners
+    Vec_Ptr_t *    vCorners;      // timing managers of other PVT corners
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
     float          SumArea0;      // total area at the begining 
     float          MaxDelay0;     // max delay at the begining
+    float          CornerDelay0;  // max delay of this corner alone at the begining
     float          BestDelay;     // best delay in the middle
     float          ReportDelay;   // delay to report
     // runtime statistics
@@ -109,6 +113,10 @@ static inline SC_Lib  * Abc_SclObjLib( Abc_Obj_t * p )
 static inline int       Abc_SclObjCellId( Abc_Obj_t * p )                           { return Vec_IntEntry( p->pNtk->vGates, Abc_ObjId(p) );                               }
 static inline SC_Cell * Abc_SclObjCell( Abc_Obj_t * p )                             { int c = Abc_SclObjCellId(p); return c == -1 ? NULL:SC_LibCell(Abc_SclObjLib(p), c); }
 static inline void      Abc_SclObjSetCell( Abc_Obj_t * p, SC_Cell * pCell )         { Vec_IntWriteEntry( p->pNtk->vGates, Abc_ObjId(p), pCell->Id );                      }
+static inline SC_Cell * Abc_SclManObjCell( SC_Man * p, Abc_Obj_t * pObj )           { int c = Abc_SclObjCellId(pObj); return c == -1 ? NULL:SC_LibCell(p->pLib, c);       }
+
+static inline int       Abc_SclManCornerNum( SC_Man * p )                           { return 1 + (p->vCorners ? Vec_PtrSize(p->vCorners) : 0);                            }
+static inline SC_Man *  Abc_SclManCorner( SC_Man * p, int i )                       { return i ? (SC_Man *)Vec_PtrEntry(p->vCorners, i-1) : p;                            }
 
 static inline SC_Pair * Abc_SclObjLoad( SC_Man * p, Abc_Obj_t * pObj )              { return p->pLoads + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )              { return p->pDepts + Abc_ObjId(pObj);  }
@@ -129,6 +137,12 @@ static inline float     Abc_SclObjInDrive( SC_Man * p, Abc_Obj_t * pObj )
 static inline void      Abc_SclObjSetInDrive( SC_Man * p, Abc_Obj_t * pObj, float c){ Vec_FltWriteEntry( p->vInDrive, pObj->iData, c );                                   }
 
 
+// iterates through the timing managers of all corners (the first one is the manager itself)
+#define Abc_SclManForEachCorner( p, pCorner, i )                                      \
+    for ( i = 0; (i < Abc_SclManCornerNum(p)) && (((pCorner) = Abc_SclManCorner(p, i)), 1); i++ )
+#define Abc_SclManForEachCornerStart( p, pCorner, i, Start )                          \
+    for ( i = Start; (i < Abc_SclManCornerNum(p)) && (((pCorner) = Abc_SclManCorner(p, i)), 1); i++ )
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -189,18 +203,13 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
         pObj->iData = i;
     return p;
 }
-static inline void Abc_SclManFree( SC_Man * p )
+static inline void Abc_SclManFreeInt( SC_Man * p )
 {
-    Abc_Obj_t * pObj;
+    SC_Man * pCorner;
     int i;
-    // set CI/CO ids
-    Abc_NtkForEachCi( p->pNtk, pObj, i )
-        pObj->iData = 0;
-    Abc_NtkForEachCo( p->pNtk, pObj, i )
-        pObj->iData = 0;
-    // other
-    p->pNtk->pSCLib = NULL;
-    Vec_IntFreeP( &p->pNtk->vGates );
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclManFreeInt( pCorner );
+    Vec_PtrFreeP( &p->vCorners );
     Vec_IntFreeP( &p->vNodeIter );
     Vec_QueFreeP( &p->vNodeByGain );
     Vec_FltFreeP( &p->vNode2Gain );
@@ -228,6 +237,20 @@ static inline void Abc_SclManFree( SC_Man * p )
     ABC_FREE( p->pSlews );
     ABC_FREE( p );
 }
+static inline void Abc_SclManFree( SC_Man * p )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    // set CI/CO ids
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        pObj->iData = 0;
+    Abc_NtkForEachCo( p->pNtk, pObj, i )
+        pObj->iData = 0;
+    // other
+    p->pNtk->pSCLib = NULL;
+    Vec_IntFreeP( &p->pNtk->vGates );
+    Abc_SclManFreeInt( p );
+}
 /*
 static inline void Abc_SclManCleanTime( SC_Man * p )
 {
@@ -280,7 +303,9 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
 
   Synopsis    [Stores/retrivies information for the logic cone.]
 
-  Description []
+  Description [When the library has several corners, the information is 
+  stored/retrieved in the managers of all corners, and the evaluation 
+  returns the worst result across the corners.]
                
   SideEffects []
 
@@ -290,6 +315,7 @@ static inline void Abc_SclManCleanTime( SC_Man * p )
 static inline void Abc_SclLoadStore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
+    SC_Man * pCorner;
     int i;
     Vec_FltClear( p->vLoads2 );
     Abc_ObjForEachFanin( pObj, pFanin, i )
@@ -297,10 +323,13 @@ static inline void Abc_SclLoadStore( SC_Man * p, Abc_Obj_t * pObj )
         Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->rise );
         Vec_FltPush( p->vLoads2, Abc_SclObjLoad(p, pFanin)->fall );
     }
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclLoadStore( pCorner, pObj );
 }
 static inline void Abc_SclLoadRestore( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
+    SC_Man * pCorner;
     int i, k = 0;
     Abc_ObjForEachFanin( pObj, pFanin, i )
     {
@@ -308,11 +337,14 @@ static inline void Abc_SclLoadRestore( SC_Man * p, Abc_Obj_t * pObj )
         Abc_SclObjLoad(p, pFanin)->fall = Vec_FltEntry(p->vLoads2, k++);
     }
     assert( Vec_FltSize(p->vLoads2) == k );
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclLoadRestore( pCorner, pObj );
 }
 
 static inline void Abc_SclLoadStore3( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
+    SC_Man * pCorner;
     int i;
     Vec_FltClear( p->vLoads3 );
     Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pObj)->rise );
@@ -322,10 +354,13 @@ static inline void Abc_SclLoadStore3( SC_Man * p, Abc_Obj_t * pObj )
         Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pFanin)->rise );
         Vec_FltPush( p->vLoads3, Abc_SclObjLoad(p, pFanin)->fall );
     }
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclLoadStore3( pCorner, pObj );
 }
 static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanin;
+    SC_Man * pCorner;
     int i, k = 0;
     Abc_SclObjLoad(p, pObj)->rise = Vec_FltEntry(p->vLoads3, k++);
     Abc_SclObjLoad(p, pObj)->fall = Vec_FltEntry(p->vLoads3, k++);
@@ -335,10 +370,13 @@ static inline void Abc_SclLoadRestore3( SC_Man * p, Abc_Obj_t * pObj )
         Abc_SclObjLoad(p, pFanin)->fall = Vec_FltEntry(p->vLoads3, k++);
     }
     assert( Vec_FltSize(p->vLoads3) == k );
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclLoadRestore3( pCorner, pObj );
 }
 static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
+    SC_Man * pCorner;
     int i;
     Vec_FltClear( p->vTimes2 );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
@@ -348,10 +386,13 @@ static inline void Abc_SclConeStore( SC_Man * p, Vec_Int_t * vCone )
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->rise );
         Vec_FltPush( p->vTimes2, Abc_SclObjSlew(p, pObj)->fall );
     }
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclConeStore( pCorner, vCone );
 }
 static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
+    SC_Man * pCorner;
     int i, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -361,10 +402,13 @@ static inline void Abc_SclConeRestore( SC_Man * p, Vec_Int_t * vCone )
         Abc_SclObjSlew(p, pObj)->fall = Vec_FltEntry(p->vTimes2, k++);
     }
     assert( Vec_FltSize(p->vTimes2) == k );
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclConeRestore( pCorner, vCone );
 }
 static inline void Abc_SclEvalStore( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
+    SC_Man * pCorner;
     int i;
     Vec_FltClear( p->vTimes3 );
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
@@ -372,10 +416,13 @@ static inline void Abc_SclEvalStore( SC_Man * p, Vec_Int_t * vCone )
         Vec_FltPush( p->vTimes3, Abc_SclObjTime(p, pObj)->rise );
         Vec_FltPush( p->vTimes3, Abc_SclObjTime(p, pObj)->fall );
     }
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Abc_SclEvalStore( pCorner, vCone );
 }
 static inline float Abc_SclEvalPerform( SC_Man * p, Vec_Int_t * vCone )
 {
     Abc_Obj_t * pObj;
+    SC_Man * pCorner;
     float Diff, Multi = 1.5, Eval = 0;
     int i, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
@@ -385,12 +432,16 @@ static inline float Abc_SclEvalPerform( SC_Man * p, Vec_Int_t * vCone )
         Eval += 0.5 * (Diff > 0 ? Diff : Multi * Diff);
     }
     assert( Vec_FltSize(p->vTimes3) == k );
-    return Eval / Vec_IntSize(vCone);
+    Eval /= Vec_IntSize(vCone);
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        Eval = Abc_MinFloat( Eval, Abc_SclEvalPerform(pCorner, vCone) );
+    return Eval;
 }
 static inline float Abc_SclEvalPerformLegal( SC_Man * p, Vec_Int_t * vCone, float D )
 {
     Abc_Obj_t * pObj;
-    float Rise, Fall, Multi = 1.0, Eval = 0;
+    SC_Man * pCorner;
+    float Rise, Fall, Multi = 1.0, Eval = 0, EvalCorner;
     int i, k = 0;
     Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
     {
@@ -401,7 +452,16 @@ static inline float Abc_SclEvalPerformLegal( SC_Man * p, Vec_Int_t * vCone, floa
         Eval += 0.5 * Rise + 0.5 * Fall;
     }
     assert( Vec_FltSize(p->vTimes3) == k );
-    return Eval / Vec_IntSize(vCone);
+    Eval /= Vec_IntSize(vCone);
+    // other corners are checked against their own delay
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+    {
+        EvalCorner = Abc_SclEvalPerformLegal( pCorner, vCone, pCorner->CornerDelay0 );
+        if ( EvalCorner == -1 )
+            return -1;
+        Eval = Abc_MinFloat( Eval, EvalCorner );
+    }
+    return Eval;
 }
 static inline void Abc_SclConeClean( SC_Man * p, Vec_Int_t * vCone )
 {
@@ -471,10 +531,28 @@ static inline float Abc_SclGetMaxDelayNodeFanins( SC_Man * p, Abc_Obj_t * pNode
         fMaxArr = Abc_MaxFloat( fMaxArr, Abc_SclObjTimeMax(p, pObj) );
     return fMaxArr;
 }
-static inline float Abc_SclReadMaxDelay( SC_Man * p )
+static inline float Abc_SclReadCornerDelay( SC_Man * p )
 {
     return Abc_SclObjTimeMax( p, Abc_NtkCo(p->pNtk, Vec_QueTop(p->vQue)) );
 }
+static inline float Abc_SclReadMaxDelay( SC_Man * p )
+{
+    SC_Man * pCorner;
+    float fMaxArr = Abc_SclReadCornerDelay( p );
+    int i;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        fMaxArr = Abc_MaxFloat( fMaxArr, Abc_SclReadCornerDelay(pCorner) );
+    return fMaxArr;
+}
+static inline SC_Man * Abc_SclReadWorstCorner( SC_Man * p )
+{
+    SC_Man * pCorner, * pWorst = p;
+    int i;
+    Abc_SclManForEachCornerStart( p, pCorner, i, 1 )
+        if ( Abc_SclReadCornerDelay(pWorst) < Abc_SclReadCornerDelay(pCorner) )
+            pWorst = pCorner;
+    return pWorst;
+}
 
 /**Function*************************************************************
 
@@ -563,13 +641,13 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
@@ -97,7 +97,7 @@ Vec_Int_t * Abc_SclFindTFO( Abc_Ntk_t * p, Vec_Int_t * vPath )
 ***********************************************************************/
 Vec_Int_t * Abc_SclFindCriticalCoWindow( SC_Man * p, int Window )
 {
-    float fMaxArr = Abc_SclReadMaxDelay( p ) * (100.0 - Window) / 100.0;
+    float fMaxArr = Abc_SclReadCornerDelay( p ) * (100.0 - Window) / 100.0;
     Vec_Int_t * vPivots;
     Abc_Obj_t * pObj;
     int i;
@@ -158,7 +158,7 @@ void Abc_SclFindCriticalNodeWindow_rec( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t
 }
 Vec_Int_t * Abc_SclFindCriticalNodeWindow( SC_Man * p, Vec_Int_t * vPathCos, int Window, int fDept )
 {
-    float fMaxArr = Abc_SclReadMaxDelay( p );
+    float fMaxArr = Abc_SclReadCornerDelay( p );
     float fSlackMax = fMaxArr * Window / 100.0;
     Vec_Int_t * vPath = Vec_IntAlloc( 100 );
     Abc_Obj_t * pObj;
@@ -263,9 +263,11 @@ void Abc_SclFindNodesToUpdate( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Finds the best gate size for the node.]
 
-  Description []
+  Description [When the library has several corners, the timing is updated
+  in all of them and each candidate is ranked by its worst gain across 
+  the corners.]
                
   SideEffects []
 
@@ -336,10 +338,11 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
 int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fVeryVerbose )
 {
     SC_Cell * pCellOld, * pCellNew;
+    SC_Man * pCorner;
     Vec_Ptr_t * vFanouts;
     Vec_Int_t * vRecalcs, * vEvals;
     Abc_Obj_t * pBuf, * pFanin, * pFanout, * pExtra;
-    int i, j, iNode, gateBest, gateBest2, fanBest, Counter = 0;
+    int i, j, k, iNode, gateBest, gateBest2, fanBest, Counter = 0;
     float dGainBest, dGainBest2;
 
     // compute savings due to bypassing buffers
@@ -476,11 +479,17 @@ int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notc
 //            break;
         // redirect
         Abc_SclUpdateLoadSplit( p, pBuf, pFanout );
-        Abc_SclAddWireLoad( p, pBuf, 1 );
-        Abc_SclAddWireLoad( p, pFanin, 1 );
+        Abc_SclManForEachCorner( p, pCorner, k )
+        {
+            Abc_SclAddWireLoad( pCorner, pBuf, 1 );
+            Abc_SclAddWireLoad( pCorner, pFanin, 1 );
+        }
         Abc_ObjPatchFanin( pFanout, pBuf, pFanin );
-        Abc_SclAddWireLoad( p, pBuf, 0 );
-        Abc_SclAddWireLoad( p, pFanin, 0 );
+        Abc_SclManForEachCorner( p, pCorner, k )
+        {
+            Abc_SclAddWireLoad( pCorner, pBuf, 0 );
+            Abc_SclAddWireLoad( pCorner, pFanin, 0 );
+        }
         Abc_SclTimeIncUpdateLevel( pFanout );
         // remember
         Vec_IntPush( p->vUpdates2, Abc_ObjId(pFanout) );
@@ -890,7 +899,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nThreads );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -904,10 +913,10 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     {
         for ( win = pPars->Window + ((i % 7) == 6); win <= 100;  win *= 2 )
         {
-            // detect critical path
+            // detect critical path (in the worst corner)
             clk = Abc_Clock();
-            vPathPos   = Abc_SclFindCriticalCoWindow( p, win );
-            vPathNodes = Abc_SclFindCriticalNodeWindow( p, vPathPos, win, pPars->fUseDept );
+            vPathPos   = Abc_SclFindCriticalCoWindow( Abc_SclReadWorstCorner(p), win );
+            vPathNodes = Abc_SclFindCriticalNodeWindow( Abc_SclReadWorstCorner(p), vPathPos, win, pPars->fUseDept );
             p->timeCone += Abc_Clock() - clk;
 
             // selectively upsize the nodes
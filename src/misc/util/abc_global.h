@@ -65,6 +65,15 @@
 #endif
 #endif
 
+// thread-local storage for the static state of utilities called from threads
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
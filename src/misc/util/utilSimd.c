@@ -0,0 +1,227 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-parallel simulation kernels.]
+
+  Synopsis    [Word-parallel simulation kernels.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "utilSimd.h"
+
+// the vector kernels need GCC/Clang function attributes and CPU detection
+#if !defined(ABC_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define ABC_USE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef void (*Abc_SimdAnd_f) ( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords );
+typedef void (*Abc_SimdAndU_f)( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords );
+
+static void Abc_SimdAndScalar ( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords );
+static void Abc_SimdAndUScalar( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords );
+
+// the kernels are scalar until Abc_SimdInit() is called at startup
+static Abc_SimdAnd_f  s_pSimdAnd  = Abc_SimdAndScalar;
+static Abc_SimdAndU_f s_pSimdAndU = Abc_SimdAndUScalar;
+
+static inline word     Abc_SimdMask( int fCompl )  { return fCompl ? ~(word)0 : 0;     }
+static inline unsigned Abc_SimdMaskU( int fCompl ) { return fCompl ? ~(unsigned)0 : 0; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Also used to process the words that do not fill
+  a complete vector register.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords )
+{
+    word Diff0 = Abc_SimdMask(fCompl0), Diff1 = Abc_SimdMask(fCompl1), DiffOut = Abc_SimdMask(fComplOut);
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((p0[w] ^ Diff0) & (p1[w] ^ Diff1)) ^ DiffOut;
+}
+static void Abc_SimdAndUScalar( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords )
+{
+    unsigned Diff0 = Abc_SimdMaskU(fCompl0), Diff1 = Abc_SimdMaskU(fCompl1), DiffOut = Abc_SimdMaskU(fComplOut);
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((p0[w] ^ Diff0) & (p1[w] ^ Diff1)) ^ DiffOut;
+}
+
+#ifdef ABC_USE_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels (256 bits at a time).]
+
+  Description [Unaligned loads and stores are used, so the arrays
+  need only the alignment of their element type.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdAndAvx2( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords )
+{
+    __m256i Diff0   = _mm256_set1_epi64x( (long long)Abc_SimdMask(fCompl0) );
+    __m256i Diff1   = _mm256_set1_epi64x( (long long)Abc_SimdMask(fCompl1) );
+    __m256i DiffOut = _mm256_set1_epi64x( (long long)Abc_SimdMask(fComplOut) );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), Diff0 );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), Diff1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_and_si256(In0, In1), DiffOut) );
+    }
+    Abc_SimdAndScalar( pOut + w, p0 + w, fCompl0, p1 + w, fCompl1, fComplOut, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Abc_SimdAndUAvx2( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords )
+{
+    __m256i Diff0   = _mm256_set1_epi32( (int)Abc_SimdMaskU(fCompl0) );
+    __m256i Diff1   = _mm256_set1_epi32( (int)Abc_SimdMaskU(fCompl1) );
+    __m256i DiffOut = _mm256_set1_epi32( (int)Abc_SimdMaskU(fComplOut) );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), Diff0 );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), Diff1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_and_si256(In0, In1), DiffOut) );
+    }
+    Abc_SimdAndUScalar( pOut + w, p0 + w, fCompl0, p1 + w, fCompl1, fComplOut, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels (512 bits at a time).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdAndAvx512( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords )
+{
+    __m512i Diff0   = _mm512_set1_epi64( (long long)Abc_SimdMask(fCompl0) );
+    __m512i Diff1   = _mm512_set1_epi64( (long long)Abc_SimdMask(fCompl1) );
+    __m512i DiffOut = _mm512_set1_epi64( (long long)Abc_SimdMask(fComplOut) );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i In0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), Diff0 );
+        __m512i In1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), Diff1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_and_si512(In0, In1), DiffOut) );
+    }
+    Abc_SimdAndScalar( pOut + w, p0 + w, fCompl0, p1 + w, fCompl1, fComplOut, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdAndUAvx512( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords )
+{
+    __m512i Diff0   = _mm512_set1_epi32( (int)Abc_SimdMaskU(fCompl0) );
+    __m512i Diff1   = _mm512_set1_epi32( (int)Abc_SimdMaskU(fCompl1) );
+    __m512i DiffOut = _mm512_set1_epi32( (int)Abc_SimdMaskU(fComplOut) );
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        __m512i In0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), Diff0 );
+        __m512i In1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), Diff1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_and_si512(In0, In1), DiffOut) );
+    }
+    Abc_SimdAndUScalar( pOut + w, p0 + w, fCompl0, p1 + w, fCompl1, fComplOut, nWords - w );
+}
+
+#endif // ABC_USE_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [Called once from Abc_FrameInit(), before any threads
+  are started, so the kernel pointers are never written concurrently.
+  Until then (or if the CPU lacks the instruction sets) the scalar
+  kernels are used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdInit()
+{
+#ifdef ABC_USE_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+    {
+        s_pSimdAnd  = Abc_SimdAndAvx512;
+        s_pSimdAndU = Abc_SimdAndUAvx512;
+    }
+    else if ( __builtin_cpu_supports("avx2") )
+    {
+        s_pSimdAnd  = Abc_SimdAndAvx2;
+        s_pSimdAndU = Abc_SimdAndUAvx2;
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulation kernels for long arrays.]
+
+  Description [Called by Abc_SimdAnd() and Abc_SimdAndU() in utilSimd.h
+  for arrays long enough to amortize the indirect call. The arrays may
+  overlap only if they are identical.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdAndVec( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords )
+{
+    s_pSimdAnd( pOut, p0, fCompl0, p1, fCompl1, fComplOut, nWords );
+}
+void Abc_SimdAndUVec( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords )
+{
+    s_pSimdAndU( pOut, p0, fCompl0, p1, fCompl1, fComplOut, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
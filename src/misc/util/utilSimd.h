@@ -0,0 +1,116 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-parallel simulation kernels.]
+
+  Synopsis    [Word-parallel simulation kernels.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// shorter arrays are processed by the inline scalar loop
+#define ABC_SIMD_WORDS_MIN   16   // in 64-bit words
+#define ABC_SIMD_WORDS_MIN_U 32   // in 32-bit words
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+
+extern void         Abc_SimdInit();
+extern void         Abc_SimdAndVec( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords );
+extern void         Abc_SimdAndUVec( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// pOut = (p0 ^ fCompl0) & (p1 ^ fCompl1) ^ fComplOut
+static inline void Abc_SimdAnd( word * pOut, word * p0, int fCompl0, word * p1, int fCompl1, int fComplOut, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN )
+    {
+        Abc_SimdAndVec( pOut, p0, fCompl0, p1, fCompl1, fComplOut, nWords );
+        return;
+    }
+    if ( fCompl0 && fCompl1 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~(p0[w] | p1[w]);
+    else if ( fCompl0 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~p0[w] & p1[w];
+    else if ( fCompl1 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = p0[w] & ~p1[w];
+    else
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = p0[w] & p1[w];
+    if ( fComplOut )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~pOut[w];
+}
+// the same kernel for simulation info stored as 32-bit words
+static inline void Abc_SimdAndU( unsigned * pOut, unsigned * p0, int fCompl0, unsigned * p1, int fCompl1, int fComplOut, int nWords )
+{
+    int w;
+    if ( nWords >= ABC_SIMD_WORDS_MIN_U )
+    {
+        Abc_SimdAndUVec( pOut, p0, fCompl0, p1, fCompl1, fComplOut, nWords );
+        return;
+    }
+    if ( fCompl0 && fCompl1 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~(p0[w] | p1[w]);
+    else if ( fCompl0 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~p0[w] & p1[w];
+    else if ( fCompl1 )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = p0[w] & ~p1[w];
+    else
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = p0[w] & p1[w];
+    if ( fComplOut )
+        for ( w = nWords-1; w >= 0; w-- )
+            pOut[w] = ~pOut[w];
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -51,6 +51,7 @@ struct Dar_RwrPar_t_
     int              fUseZeros;      // performs zero-cost replacement
     int              fPower;         // enables power-aware rewriting
     int              fRecycle;       // enables cut recycling
+    int              nThreads;       // the number of threads evaluating cuts
     int              fVerbose;       // enables verbose output
     int              fVeryVerbose;   // enables very verbose output
 };
@@ -92,6 +93,7 @@ extern void            Dar_BalancePrintStats( Aig_Man_t * p );
 extern void            Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose );
+extern Aig_MmFixed_t * Dar_ManComputeCutsMt( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads );
 /*=== darRefact.c ========================================================*/
 extern void            Dar_ManDefaultRefParams( Dar_RefPar_t * pPars );
 extern int             Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars );
@@ -100,6 +102,7 @@ extern Aig_Man_t *     Dar_ManRewriteDefault( Aig_Man_t * pAig );
 extern Aig_Man_t *     Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
 extern Aig_Man_t *     Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fVerbose );
 extern Aig_Man_t *     Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose );
+extern Aig_Man_t *     Dar_ManCompress2Mt( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose );
 extern Aig_Man_t *     Dar_ManChoice( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fConstruct, int nConfMax, int nLevelMax, int fVerbose );
 
 
@@ -19,6 +19,17 @@
 ***********************************************************************/
 
 #include "darInt.h"
+#include "misc/vec/vecWec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -58,6 +69,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nThreads     =  0;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -66,7 +78,48 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Replaces the node if it has a trivial cut.]
+
+  Description [Returns 1 if the node was replaced by a constant or 
+  by a leaf.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ObjRewriteTrivial( Dar_Man_t * p, Aig_Obj_t * pObj )
+{
+    Dar_Cut_t * pCut;
+    Aig_Obj_t * pObjNew;
+    int k;
+    // check if there is a trivial cut
+    Dar_ObjForEachCut( pObj, pCut, k )
+        if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id && Aig_ManObj(p->pAig, pCut->pLeaves[0])) )
+            break;
+    if ( k == (int)pObj->nCuts )
+        return 0;
+    assert( pCut->nLeaves < 2 );
+    if ( pCut->nLeaves == 0 ) // replace by constant
+    {
+        assert( pCut->uTruth == 0 || pCut->uTruth == 0xFFFF );
+        pObjNew = Aig_NotCond( Aig_ManConst1(p->pAig), pCut->uTruth==0 );
+    }
+    else
+    {
+        assert( pCut->uTruth == 0xAAAA || pCut->uTruth == 0x5555 );
+        pObjNew = Aig_NotCond( Aig_ManObj(p->pAig, pCut->pLeaves[0]), pCut->uTruth==0x5555 );
+    }
+    // remove the old cuts
+    Dar_ObjSetCuts( pObj, NULL );
+    // replace the node
+    Aig_ObjReplace( p->pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by the best structure found.]
 
   Description []
                
@@ -75,37 +128,91 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+static void Dar_ObjRewriteCommit( Dar_Man_t * p, Aig_Obj_t * pObj, int Required )
+{
+    Aig_Obj_t * pObjNew;
+    int nNodeBefore, nNodeAfter;
+    // remove the old cuts
+    Dar_ObjSetCuts( pObj, NULL );
+    // if we end up here, a rewriting step is accepted
+    nNodeBefore = Aig_ManNodeNum( p->pAig );
+    pObjNew = Dar_LibBuildBest( p ); // pObjNew can be complemented!
+    pObjNew = Aig_NotCond( pObjNew, Aig_ObjPhaseReal(pObjNew) ^ pObj->fPhase );
+    assert( (int)Aig_Regular(pObjNew)->Level <= Required );
+    // replace the node
+    Aig_ObjReplace( p->pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+    // compare the gains
+    nNodeAfter = Aig_ManNodeNum( p->pAig );
+    assert( p->GainBest <= nNodeBefore - nNodeAfter );
+    // count gains of this class
+    p->ClassGains[p->ClassBest] += nNodeBefore - nNodeAfter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one rewriting step for the node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ObjRewrite( Dar_Man_t * p, Aig_Obj_t * pObj )
 {
-    extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
-    Dar_Man_t * p;
-//    Bar_Progress_t * pProgress;
     Dar_Cut_t * pCut;
-    Aig_Obj_t * pObj, * pObjNew;
-    int i, k, nNodesOld, nNodeBefore, nNodeAfter, Required;
-    abctime clk = 0, clkStart;
-    int Counter = 0;
-    int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
-    // prepare the library
-    Dar_LibPrepare( pPars->nSubgMax ); 
-    // create rewriting manager
-    p = Dar_ManStart( pAig, pPars );
-    if ( pPars->fPower )
-        pAig->vProbs = Saig_ManComputeSwitchProbs( pAig, 48, 16, 1 );
-    // remove dangling nodes
-    Aig_ManCleanup( pAig );
-    // if updating levels is requested, start fanout and timing
-    if ( p->pPars->fFanout )
-        Aig_ManFanoutStart( pAig );
-    if ( p->pPars->fUpdateLevel )
-        Aig_ManStartReverseLevels( pAig, 0 );
-    // set elementary cuts for the PIs
-//    Dar_ManCutsStart( p );
-    // resynthesize each node once
-    clkStart = Abc_Clock();
-    p->nNodesInit = Aig_ManNodeNum(pAig);
-    nNodesOld = Vec_PtrSize( pAig->vObjs );
+    int k, Required, nMffcSize;
+    abctime clk;
+    // compute cuts for the node
+    p->nNodesTried++;
+clk = Abc_Clock();
+    Dar_ObjSetCuts( pObj, NULL );
+    Dar_ObjComputeCuts_rec( p, pObj );
+p->timeCuts += Abc_Clock() - clk;
+
+    // check if there is a trivial cut
+    if ( Dar_ObjRewriteTrivial( p, pObj ) )
+        return;
+
+    // evaluate the cuts
+    p->GainBest = -1;
+    nMffcSize   = -1;
+    Required    = p->pAig->vLevelR? Aig_ObjRequiredLevel(p->pAig, pObj) : ABC_INFINITY;
+    Dar_ObjForEachCut( pObj, pCut, k )
+    {
+        int nLeavesOld = pCut->nLeaves;
+        if ( pCut->nLeaves == 3 )
+            pCut->pLeaves[pCut->nLeaves++] = 0;
+        Dar_LibEval( p, pObj, pCut, Required, &nMffcSize );
+        pCut->nLeaves = nLeavesOld; 
+    }
+    // check the best gain
+    if ( !(p->GainBest > 0 || (p->GainBest == 0 && p->pPars->fUseZeros)) )
+    {
+//        Aig_ObjOrderAdvance( p->pAig );
+        return;
+    }
+//    nMffcGains[p->GainBest < MAX_VAL ? p->GainBest : MAX_VAL][nMffcSize < MAX_VAL ? nMffcSize : MAX_VAL]++;
+    Dar_ObjRewriteCommit( p, pObj, Required );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the nodes one at a time.]
+
+  Description []
+               
+  SideEffects []
 
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManRewriteNodes( Dar_Man_t * p, int nNodesOld )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Aig_Obj_t * pObj;
+    int i, Counter = 0;
 //    pProgress = Bar_ProgressStart( stdout, nNodesOld );
     Aig_ManForEachObj( pAig, pObj, i )
 //    pProgress = Bar_ProgressStart( stdout, 100 );
@@ -121,7 +228,7 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
         if ( i > nNodesOld )
 //        if ( p->pPars->fUseZeros && i > nNodesOld )
             break;
-        if ( pPars->fRecycle && ++Counter % 50000 == 0 && Aig_DagSize(pObj) < Vec_PtrSize(p->vCutNodes)/100 )
+        if ( p->pPars->fRecycle && ++Counter % 50000 == 0 && Aig_DagSize(pObj) < Vec_PtrSize(p->vCutNodes)/100 )
         {
 //            printf( "Counter = %7d.  Node = %7d.  Dag = %5d. Vec = %5d.\n", 
 //                Counter, i, Aig_DagSize(pObj), Vec_PtrSize(p->vCutNodes) );
@@ -133,71 +240,346 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
 //        if ( (i & 0xFFF) == 0 && Aig_MmFixedReadMemUsage(p->pMemCuts)/(1<<20) > 100 )
 //            Dar_ManCutsStart( p );
 
-        // compute cuts for the node
-        p->nNodesTried++;
-clk = Abc_Clock();
-        Dar_ObjSetCuts( pObj, NULL );
-        Dar_ObjComputeCuts_rec( p, pObj );
-p->timeCuts += Abc_Clock() - clk;
+        // rewrite the node
+        Dar_ObjRewrite( p, pObj );
+    }
+}
 
-        // check if there is a trivial cut
-        Dar_ObjForEachCut( pObj, pCut, k )
-            if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id && Aig_ManObj(p->pAig, pCut->pLeaves[0])) )
-                break;
-        if ( k < (int)pObj->nCuts )
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the nodes in batches evaluated by several threads.]
+
+  Description [The nodes are taken in the same order as in the serial 
+  loop, in batches of DAR_RWR_BATCH. For each batch, the calling thread
+  computes the cuts and removes the nodes with trivial cuts. Then the
+  worker threads evaluate the library structures for the cuts of all
+  nodes of the batch against the unchanged AIG, using private data,
+  and record the best cut of each node, together with the nodes whose
+  references and presence the evaluation depended on. Finally, the 
+  calling thread visits the nodes in order and applies the improvements.
+  If earlier replacements in the same batch have removed one of these
+  nodes or changed its references (that is, the cones of the two nodes
+  overlap), the node is a conflict. Otherwise, the recorded cut is 
+  evaluated again in the current AIG before it is used, because the 
+  existing nodes that can be shared may have changed, and the node is 
+  a conflict if there is no gain any more. The conflicts are re-queued
+  to the front of the next batch; a node that conflicts DAR_RWR_RETRY 
+  times is handled as in the serial loop. With zero-cost replacements, 
+  the conflicts are handled in the serial way right away, because 
+  re-queuing them changes the result too much. Returns 0 if threads are
+  not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Dar_ManRewriteMt( Dar_Man_t * p, int nNodesOld )
+{
+    return 0;
+}
+
+#else // pthreads are used
+
+#define DAR_THR_MAX        100   // the largest number of threads
+#define DAR_RWR_BATCH     4096   // the number of nodes evaluated together
+#define DAR_RWR_RETRY        3   // the number of times a conflict is re-queued
+
+typedef struct Dar_RwrCand_t_
+{
+    int             iNode;       // the node
+    int             fRetry;      // the number of conflicts of the node so far
+    int             Required;    // its required level
+    Vec_Int_t *     vObs;        // the observed nodes of the thread
+    int             iObs;        // the first entry of this node in vObs
+    int             iObsStop;    // the last entry of this node in vObs
+    int             Gain;        // the best gain
+    Dar_Cut_t       Cut;         // the cut giving the best gain
+} Dar_RwrCand_t;
+
+typedef struct Dar_RwrThPool_t_
+{
+    Dar_RwrCand_t * pCands;      // the candidates of the current batch
+    int             nCands;      // the number of candidates
+    int             nThreads;    // the number of threads
+    int             iRound;      // the number of batches posted
+    int             nBusy;       // the number of threads still working
+    int             fStop;       // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;   // signals the threads about a new batch
+    pthread_cond_t  CondDone;    // signals the main thread about completion
+} Dar_RwrThPool_t;
+
+typedef struct Dar_RwrThData_t_
+{
+    Dar_Man_t       Man;         // the copy of the manager with private counters
+    Dar_RwrThPool_t * pPool;     // the thread pool
+    Dar_LibThr_t *  pLib;        // private library data
+    Vec_Int_t *     vObs;        // the observed nodes with their references
+    int             iThread;     // the thread number
+} Dar_RwrThData_t;
+
+void * Dar_ManRewriteWorkerThread( void * pArg )
+{
+    Dar_RwrThData_t * pThData = (Dar_RwrThData_t *)pArg;
+    Dar_RwrThPool_t * pPool = pThData->pPool;
+    Dar_Man_t * p = &pThData->Man;
+    Dar_RwrCand_t * pCand;
+    Dar_Cut_t * pCut, Cut;
+    Aig_Obj_t * pObj;
+    int i, k, iStart, iStop, nPerThread, iRound = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        nPerThread = (pPool->nCands + pPool->nThreads - 1) / pPool->nThreads;
+        iStart = Abc_MinInt( pThData->iThread * nPerThread, pPool->nCands );
+        iStop  = Abc_MinInt( (pThData->iThread + 1) * nPerThread, pPool->nCands );
+        Vec_IntClear( pThData->vObs );
+        for ( i = iStart; i < iStop; i++ )
         {
-            assert( pCut->nLeaves < 2 );
-            if ( pCut->nLeaves == 0 ) // replace by constant
+            pCand = pPool->pCands + i;
+            pCand->Gain = -1;
+            pCand->vObs = pThData->vObs;
+            pCand->iObs = pCand->iObsStop = Vec_IntSize( pThData->vObs );
+            pObj = Aig_ManObj( p->pAig, pCand->iNode );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) || Dar_ObjCuts(pObj) == NULL )
+                continue;
+            p->GainBest = -1;
+            Dar_ObjForEachCut( pObj, pCut, k )
             {
-                assert( pCut->uTruth == 0 || pCut->uTruth == 0xFFFF );
-                pObjNew = Aig_NotCond( Aig_ManConst1(p->pAig), pCut->uTruth==0 );
+                Cut = *pCut;
+                if ( Cut.nLeaves == 3 )
+                    Cut.pLeaves[Cut.nLeaves++] = 0;
+                Dar_LibEvalThr( p, pThData->pLib, pObj, &Cut, pCand->Required, &pCand->Cut, pThData->vObs );
             }
-            else
-            {
-                assert( pCut->uTruth == 0xAAAA || pCut->uTruth == 0x5555 );
-                pObjNew = Aig_NotCond( Aig_ManObj(p->pAig, pCut->pLeaves[0]), pCut->uTruth==0x5555 );
-            }
-            // remove the old cuts
-            Dar_ObjSetCuts( pObj, NULL );
-            // replace the node
-            Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
-            continue;
+            pCand->Gain = p->GainBest;
+            pCand->iObsStop = Vec_IntSize( pThData->vObs );
         }
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
 
-        // evaluate the cuts
-        p->GainBest = -1;
-        nMffcSize   = -1;
-        Required    = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
-        Dar_ObjForEachCut( pObj, pCut, k )
+static int Dar_ManRewriteCandIsStale( Aig_Man_t * pAig, Dar_RwrCand_t * pCand )
+{
+    Aig_Obj_t * pObj;
+    int i, nRefs;
+    for ( i = pCand->iObs; i < pCand->iObsStop; i += 2 )
+    {
+        pObj  = Aig_ManObj( pAig, Vec_IntEntry(pCand->vObs, i) );
+        nRefs = Vec_IntEntry( pCand->vObs, i+1 );
+        if ( pObj == NULL || (nRefs >= 0 && (int)pObj->nRefs != nRefs) )
+            return 1;
+    }
+    return 0;
+}
+
+int Dar_ManRewriteMt( Dar_Man_t * p, int nNodesOld )
+{
+    pthread_t WorkerThread[DAR_THR_MAX];
+    Dar_RwrThData_t ThData[DAR_THR_MAX];
+    Dar_RwrThPool_t Pool, * pPool = &Pool;
+    Aig_Man_t * pAig = p->pAig;
+    Dar_RwrCand_t * pCands, * pCand;
+    Vec_Int_t * vRetry;
+    Aig_Obj_t * pObj;
+    int i, k, iObj, iNode, fRetry, nCands, nMffcSize, status, Counter = 0;
+    int nThreads = Abc_MinInt( p->pPars->nThreads, DAR_THR_MAX );
+    // zero-cost replacements depend more on the order of the nodes
+    int nRetries = p->pPars->fUseZeros ? 0 : DAR_RWR_RETRY;
+    abctime clk;
+    pCands = ABC_CALLOC( Dar_RwrCand_t, DAR_RWR_BATCH );
+    vRetry = Vec_IntAlloc( 100 );
+    // start the threads
+    memset( pPool, 0, sizeof(Dar_RwrThPool_t) );
+    pPool->pCands   = pCands;
+    pPool->nThreads = nThreads;
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].Man = *p;
+        ThData[i].Man.nTotalSubgs = ThData[i].Man.nCutsGood = ThData[i].Man.nCutsBad = 0;
+        memset( ThData[i].Man.ClassSubgs, 0, sizeof(int) * 222 );
+        ThData[i].pPool   = pPool;
+        ThData[i].pLib    = Dar_LibThrAlloc();
+        ThData[i].vObs    = Vec_IntAlloc( 1000 );
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManRewriteWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( iObj = 0; Vec_IntSize(vRetry) > 0 || (iObj <= nNodesOld && iObj < Vec_PtrSize(pAig->vObjs)); )
+    {
+        if ( pAig->Time2Quit && Abc_Clock() > pAig->Time2Quit )
+            break;
+        // the cuts can only be recycled before the batch is started
+        if ( p->pPars->fRecycle && Counter >= 50000 )
         {
-            int nLeavesOld = pCut->nLeaves;
-            if ( pCut->nLeaves == 3 )
-                pCut->pLeaves[pCut->nLeaves++] = 0;
-            Dar_LibEval( p, pObj, pCut, Required, &nMffcSize );
-            pCut->nLeaves = nLeavesOld; 
+            Dar_ManCutsRestart( p, NULL );
+            Counter = 0;
         }
-        // check the best gain
-        if ( !(p->GainBest > 0 || (p->GainBest == 0 && p->pPars->fUseZeros)) )
+        // collect the nodes of the batch and compute their cuts
+clk = Abc_Clock();
+        nCands = 0;
+        Vec_IntForEachEntryDouble( vRetry, iNode, fRetry, i )
         {
-//            Aig_ObjOrderAdvance( pAig );
-            continue;
+            pObj = Aig_ManObj( pAig, iNode );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            Dar_ObjSetCuts( pObj, NULL );
+            Dar_ObjComputeCuts_rec( p, pObj );
+            if ( Dar_ObjRewriteTrivial( p, pObj ) )
+                continue;
+            pCand = pCands + nCands++;
+            pCand->iNode    = iNode;
+            pCand->fRetry   = fRetry;
+            pCand->Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
+        }
+        Vec_IntClear( vRetry );
+        for ( ; nCands < DAR_RWR_BATCH && iObj <= nNodesOld && iObj < Vec_PtrSize(pAig->vObjs); iObj++ )
+        {
+            pObj = Aig_ManObj( pAig, iObj );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            Counter++;
+            p->nNodesTried++;
+            Dar_ObjSetCuts( pObj, NULL );
+            Dar_ObjComputeCuts_rec( p, pObj );
+            if ( Dar_ObjRewriteTrivial( p, pObj ) )
+                continue;
+            pCand = pCands + nCands++;
+            pCand->iNode    = iObj;
+            pCand->fRetry   = 0;
+            pCand->Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
         }
-//        nMffcGains[p->GainBest < MAX_VAL ? p->GainBest : MAX_VAL][nMffcSize < MAX_VAL ? nMffcSize : MAX_VAL]++;
-        // remove the old cuts
-        Dar_ObjSetCuts( pObj, NULL );
-        // if we end up here, a rewriting step is accepted
-        nNodeBefore = Aig_ManNodeNum( pAig );
-        pObjNew = Dar_LibBuildBest( p ); // pObjNew can be complemented!
-        pObjNew = Aig_NotCond( pObjNew, Aig_ObjPhaseReal(pObjNew) ^ pObj->fPhase );
-        assert( (int)Aig_Regular(pObjNew)->Level <= Required );
-        // replace the node
-        Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
-        // compare the gains
-        nNodeAfter = Aig_ManNodeNum( pAig );
-        assert( p->GainBest <= nNodeBefore - nNodeAfter );
-        // count gains of this class
-        p->ClassGains[p->ClassBest] += nNodeBefore - nNodeAfter;
+p->timeCuts += Abc_Clock() - clk;
+        // evaluate the cuts of the batch
+clk = Abc_Clock();
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->nCands = nCands;
+        pPool->nBusy  = nThreads;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+p->timeEval += Abc_Clock() - clk;
+        // apply the improvements in the order of the nodes
+        for ( k = 0; k < nCands; k++ )
+        {
+            pCand = pCands + k;
+            pObj = Aig_ManObj( pAig, pCand->iNode );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) || Dar_ObjCuts(pObj) == NULL )
+                continue;
+            if ( !Dar_ManRewriteCandIsStale(pAig, pCand) )
+            {
+                if ( !(pCand->Gain > 0 || (pCand->Gain == 0 && p->pPars->fUseZeros)) )
+                    continue;
+                // evaluate the best cut again in the current AIG
+                p->GainBest = -1;
+                nMffcSize   = -1;
+                pCand->Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
+                Dar_LibEval( p, pObj, &pCand->Cut, pCand->Required, &nMffcSize );
+                if ( p->GainBest > 0 || (p->GainBest == 0 && p->pPars->fUseZeros) )
+                {
+                    Dar_ObjRewriteCommit( p, pObj, pCand->Required );
+                    continue;
+                }
+            }
+            // the cone or the shared nodes were changed by the earlier replacements
+            p->nConflicts++;
+            if ( pCand->fRetry < nRetries )
+            {
+                Vec_IntPush( vRetry, pCand->iNode );
+                Vec_IntPush( vRetry, pCand->fRetry + 1 );
+                continue;
+            }
+            p->nNodesTried--;
+            p->nNodesSerial++;
+            Dar_ObjRewrite( p, pObj );
+        }
+    }
+    // stop the threads and collect the statistics
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        p->nTotalSubgs += ThData[i].Man.nTotalSubgs;
+        p->nCutsGood   += ThData[i].Man.nCutsGood;
+        p->nCutsBad    += ThData[i].Man.nCutsBad;
+        for ( k = 0; k < 222; k++ )
+            p->ClassSubgs[k] += ThData[i].Man.ClassSubgs[k];
+        Dar_LibThrFree( ThData[i].pLib );
+        Vec_IntFree( ThData[i].vObs );
     }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    Vec_IntFree( vRetry );
+    ABC_FREE( pCands );
+    return 1;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
+    Dar_Man_t * p;
+//    Bar_Progress_t * pProgress;
+    int nNodesOld;
+    abctime clkStart;
+//    int nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
+    // prepare the library
+    Dar_LibPrepare( pPars->nSubgMax ); 
+    // create rewriting manager
+    p = Dar_ManStart( pAig, pPars );
+    if ( pPars->fPower )
+        pAig->vProbs = Saig_ManComputeSwitchProbs( pAig, 48, 16, 1 );
+    // remove dangling nodes
+    Aig_ManCleanup( pAig );
+    // if updating levels is requested, start fanout and timing
+    if ( p->pPars->fFanout )
+        Aig_ManFanoutStart( pAig );
+    if ( p->pPars->fUpdateLevel )
+        Aig_ManStartReverseLevels( pAig, 0 );
+    // set elementary cuts for the PIs
+//    Dar_ManCutsStart( p );
+    // resynthesize each node once
+    clkStart = Abc_Clock();
+    p->nNodesInit = Aig_ManNodeNum(pAig);
+    nNodesOld = Vec_PtrSize( pAig->vObjs );
+
+    // rewrite the nodes, using several threads if requested
+    if ( pPars->nThreads < 2 || pPars->fPower || !Dar_ManRewriteMt( p, nNodesOld ) )
+        Dar_ManRewriteNodes( p, nNodesOld );
 //    Aig_ManOrderStop( pAig );
 /*
     printf( "Distribution of gain (row) by MFFC size (column) %s 0-costs:\n", p->pPars->fUseZeros? "with":"without" );
@@ -338,6 +720,180 @@ Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtM
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for all nodes using several threads.]
+
+  Description [The cut sets are allocated up front by the calling thread.
+  The nodes are then processed level by level: the nodes of one level
+  only read the cuts of the lower levels, so they are split between
+  the threads. Small levels are processed by the calling thread.
+  The resulting cuts are the same as those of Dar_ManComputeCuts().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+Aig_MmFixed_t * Dar_ManComputeCutsMt( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads )
+{
+    return Dar_ManComputeCuts( pAig, nCutsMax, fSkipTtMin, 0 );
+}
+
+#else // pthreads are used
+
+#define DAR_THR_LEVEL_MIN  256   // the smallest level processed by threads
+
+typedef struct Dar_ThPool_t_
+{
+    Vec_Int_t *     vNodes;      // the nodes of the current level
+    int             nThreads;    // the number of threads
+    int             fSkipTtMin;  // skip truth table minimization
+    int             iRound;      // the number of levels posted
+    int             nBusy;       // the number of threads still working
+    int             fStop;       // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;   // signals the threads about a new level
+    pthread_cond_t  CondDone;    // signals the main thread about completion
+} Dar_ThPool_t;
+
+typedef struct Dar_ThData_t_
+{
+    Dar_Man_t       Man;         // the copy of the manager with private counters
+    Dar_ThPool_t *  pPool;       // the thread pool
+    int             iThread;     // the thread number
+} Dar_ThData_t;
+
+void * Dar_ManCutsWorkerThread( void * pArg )
+{
+    Dar_ThData_t * pThData = (Dar_ThData_t *)pArg;
+    Dar_ThPool_t * pPool = pThData->pPool;
+    int i, iStart, iStop, nPerThread, iRound = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        nPerThread = (Vec_IntSize(pPool->vNodes) + pPool->nThreads - 1) / pPool->nThreads;
+        iStart = Abc_MinInt( pThData->iThread * nPerThread, Vec_IntSize(pPool->vNodes) );
+        iStop  = Abc_MinInt( (pThData->iThread + 1) * nPerThread, Vec_IntSize(pPool->vNodes) );
+        for ( i = iStart; i < iStop; i++ )
+            Dar_ObjMergeCuts( &pThData->Man, Aig_ManObj(pThData->Man.pAig, Vec_IntEntry(pPool->vNodes, i)), pPool->fSkipTtMin );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+Aig_MmFixed_t * Dar_ManComputeCutsMt( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads )
+{
+    pthread_t WorkerThread[DAR_THR_MAX];
+    Dar_ThData_t ThData[DAR_THR_MAX];
+    Dar_ThPool_t Pool, * pPool = &Pool;
+    Dar_Man_t * p;
+    Dar_RwrPar_t Pars, * pPars = &Pars; 
+    Aig_Obj_t * pObj;
+    Aig_MmFixed_t * pMemCuts;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel, * vObjLevs;
+    int i, k, status;
+    nThreads = Abc_MinInt( nThreads, DAR_THR_MAX );
+    if ( nThreads < 2 )
+        return Dar_ManComputeCuts( pAig, nCutsMax, fSkipTtMin, 0 );
+    // remove dangling nodes
+    Aig_ManCleanup( pAig );
+    // create default parameters
+    Dar_ManDefaultRwrParams( pPars );
+    pPars->nCutsMax = nCutsMax;
+    // create rewriting manager
+    p = Dar_ManStart( pAig, pPars );
+    // set elementary cuts for all objects and sort nodes by level
+    Aig_MmFixedRestart( p->pMemCuts );
+    Dar_ObjPrepareCuts( p, Aig_ManConst1(p->pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Dar_ObjPrepareCuts( p, pObj );
+    vObjLevs = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    vLevels  = Vec_WecAlloc( 100 );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        int Level0 = Vec_IntEntry( vObjLevs, Aig_Regular(Aig_ObjReal_rec(Aig_ObjChild0(pObj)))->Id );
+        int Level1 = Vec_IntEntry( vObjLevs, Aig_Regular(Aig_ObjReal_rec(Aig_ObjChild1(pObj)))->Id );
+        int Level  = 1 + Abc_MaxInt( Level0, Level1 );
+        Vec_IntWriteEntry( vObjLevs, pObj->Id, Level );
+        Vec_WecPush( vLevels, Level, pObj->Id );
+        Dar_ObjPrepareCuts( p, pObj );
+    }
+    Vec_IntFree( vObjLevs );
+    // start the threads
+    memset( pPool, 0, sizeof(Dar_ThPool_t) );
+    pPool->nThreads   = nThreads;
+    pPool->fSkipTtMin = fSkipTtMin;
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].Man = *p;
+        ThData[i].Man.nCutsAll = ThData[i].Man.nCutsTried = ThData[i].Man.nCutsUsed = ThData[i].Man.nCutsSkipped = 0;
+        ThData[i].pPool   = pPool;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManCutsWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // compute cuts for each level
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) < DAR_THR_LEVEL_MIN )
+        {
+            Aig_ManForEachObjVec( vLevel, pAig, pObj, i )
+                Dar_ObjMergeCuts( p, pObj, fSkipTtMin );
+            continue;
+        }
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->vNodes = vLevel;
+        pPool->nBusy  = nThreads;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    // stop the threads and collect the statistics
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        p->nCutsAll     += ThData[i].Man.nCutsAll;
+        p->nCutsTried   += ThData[i].Man.nCutsTried;
+        p->nCutsUsed    += ThData[i].Man.nCutsUsed;
+        p->nCutsSkipped += ThData[i].Man.nCutsSkipped;
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    Vec_WecFree( vLevels );
+    // free the cuts
+    pMemCuts = p->pMemCuts;
+    p->pMemCuts = NULL;
+    // stop the rewriting manager
+    Dar_ManStop( p );
+    return pMemCuts;
+}
+
+#endif // pthreads are used
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -736,22 +736,43 @@ void Dar_ManCutsRestart( Dar_Man_t * p, Aig_Obj_t * pRoot )
 
 ***********************************************************************/
 Dar_Cut_t * Dar_ObjComputeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin )
+{
+    Dar_Cut_t * pCutSet;
+    assert( !Aig_IsComplement(pObj) );
+    assert( Aig_ObjIsNode(pObj) );
+    assert( Dar_ObjCuts(pObj) == NULL );
+    // set up the first cut
+    pCutSet = Dar_ObjPrepareCuts( p, pObj );
+    Dar_ObjMergeCuts( p, pObj, fSkipTtMin );
+    return pCutSet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fills the prepared cut set of the node by merging fanin cuts.]
+
+  Description [Only reads the fanin cuts and writes the cuts of this node,
+  so nodes whose fanin cuts are ready can be processed independently,
+  as long as each caller uses its own statistics counters.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ObjMergeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin )
 {
     Aig_Obj_t * pFanin0 = Aig_ObjReal_rec( Aig_ObjChild0(pObj) );
     Aig_Obj_t * pFanin1 = Aig_ObjReal_rec( Aig_ObjChild1(pObj) );
     Aig_Obj_t * pFaninR0 = Aig_Regular(pFanin0);
     Aig_Obj_t * pFaninR1 = Aig_Regular(pFanin1);
-    Dar_Cut_t * pCutSet, * pCut0, * pCut1, * pCut;
+    Dar_Cut_t * pCut0, * pCut1, * pCut;
     int i, k; 
 
-    assert( !Aig_IsComplement(pObj) );
-    assert( Aig_ObjIsNode(pObj) );
-    assert( Dar_ObjCuts(pObj) == NULL );
+    assert( Dar_ObjCuts(pObj) != NULL );
     assert( Dar_ObjCuts(pFaninR0) != NULL );
     assert( Dar_ObjCuts(pFaninR1) != NULL );
 
-    // set up the first cut
-    pCutSet = Dar_ObjPrepareCuts( p, pObj );
     // make sure fanins cuts are computed
     Dar_ObjForEachCut( pFaninR0, pCut0, i )
     Dar_ObjForEachCut( pFaninR1, pCut1, k )
@@ -794,14 +815,13 @@ Dar_Cut_t * Dar_ObjComputeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin
             pCut->fUsed = 0;
         }
         else if ( pCut->nLeaves < 2 )
-            return pCutSet;
+            return;
     }
     // count the number of nontrivial cuts cuts
     Dar_ObjForEachCut( pObj, pCut, i )
         p->nCutsUsed += pCut->fUsed;
     // discount trivial cut
     p->nCutsUsed--;
-    return pCutSet;
 }
 
 /**Function*************************************************************
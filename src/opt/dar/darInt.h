@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Dar_Man_t_            Dar_Man_t;
 typedef struct Dar_Cut_t_            Dar_Cut_t;
+typedef struct Dar_LibThr_t_         Dar_LibThr_t;
 
 // the AIG 4-cut
 struct Dar_Cut_t_  // 6 words
@@ -95,6 +96,8 @@ struct Dar_Man_t_
     int              nCutsBad;       // bad cuts due to absent fanin
     int              nCutsGood;      // good cuts
     int              nCutsSkipped;   // skipped bad cuts
+    int              nConflicts;     // nodes evaluated again after a conflict
+    int              nNodesSerial;   // nodes evaluated by the calling thread
     // timing statistics
     abctime          timeCuts;
     abctime          timeEval;
@@ -136,6 +139,7 @@ extern void            Dar_ManCutsFree( Dar_Man_t * p );
 extern Dar_Cut_t *     Dar_ObjPrepareCuts( Dar_Man_t * p, Aig_Obj_t * pObj );
 extern Dar_Cut_t *     Dar_ObjComputeCuts_rec( Dar_Man_t * p, Aig_Obj_t * pObj );
 extern Dar_Cut_t *     Dar_ObjComputeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin );
+extern void            Dar_ObjMergeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin );
 extern void            Dar_ObjCutPrint( Aig_Man_t * p, Aig_Obj_t * pObj );
 /*=== darData.c ===========================================================*/
 extern Vec_Int_t *     Dar_LibReadNodes();
@@ -147,6 +151,9 @@ extern void            Dar_LibStop();
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
+extern Dar_LibThr_t *  Dar_LibThrAlloc();
+extern void            Dar_LibThrFree( Dar_LibThr_t * p );
+extern void            Dar_LibEvalThr( Dar_Man_t * p, Dar_LibThr_t * pThr, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, Dar_Cut_t * pCutBest, Vec_Int_t * vObs );
 /*=== darMan.c ============================================================*/
 extern Dar_Man_t *     Dar_ManStart( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern void            Dar_ManStop( Dar_Man_t * p );
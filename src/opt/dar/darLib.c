@@ -105,6 +105,14 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
+struct Dar_LibThr_t_ // per-thread evaluation data
+{
+    Dar_LibDat_t *   pDatas;        // private object data
+    int *            pNums;         // private numbers of library objects
+    Vec_Ptr_t *      vMffc;         // nodes visited while computing MFFC
+    Vec_Int_t *      vRefs;         // their remaining references
+};
+
 static Dar_Lib_t * s_DarLib = NULL;
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
@@ -1037,6 +1045,319 @@ Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
     return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates the per-thread evaluation data.]
+
+  Description [Dar_LibEval() keeps its scratch data in the library objects
+  and in the AIG (reference counters and traversal IDs), so only one cut
+  can be evaluated at a time. The procedures below evaluate cuts using
+  private data and do not modify the AIG. They should be called after 
+  Dar_LibPrepare(), while the AIG is not being changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dar_LibThr_t * Dar_LibThrAlloc()
+{
+    Dar_LibThr_t * p;
+    int i;
+    p = ABC_CALLOC( Dar_LibThr_t, 1 );
+    p->pDatas = ABC_CALLOC( Dar_LibDat_t, s_DarLib->nDatas );
+    p->pNums  = ABC_CALLOC( int, s_DarLib->iObj );
+    for ( i = 0; i < 4; i++ )
+        p->pNums[i] = i;
+    p->vMffc  = Vec_PtrAlloc( 100 );
+    p->vRefs  = Vec_IntAlloc( 100 );
+    return p;
+}
+void Dar_LibThrFree( Dar_LibThr_t * p )
+{
+    Vec_PtrFree( p->vMffc );
+    Vec_IntFree( p->vRefs );
+    ABC_FREE( p->pDatas );
+    ABC_FREE( p->pNums );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the cut with its canonical form.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_LibCutMatchThr( Dar_Man_t * p, Dar_LibThr_t * pThr, Dar_Cut_t * pCut )
+{
+    Aig_Obj_t * pFanin;
+    unsigned uPhase;
+    char * pPerm;
+    int i;
+    assert( pCut->nLeaves == 4 );
+    // get the fanin permutation
+    uPhase = s_DarLib->pPhases[pCut->uTruth];
+    pPerm = s_DarLib->pPerms4[ (int)s_DarLib->pPerms[pCut->uTruth] ];
+    // collect fanins with the corresponding permutation/phase
+    for ( i = 0; i < (int)pCut->nLeaves; i++ )
+    {
+        pFanin = Aig_ManObj( p->pAig, pCut->pLeaves[ (int)pPerm[i] ] );
+        if ( pFanin == NULL )
+        {
+            p->nCutsBad++;
+            return 0;
+        }
+        pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
+        pThr->pDatas[i].pFunc = pFanin;
+        pThr->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+    }
+    p->nCutsGood++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the MFFC of the node without changing the AIG.]
+
+  Description [Simulates dereferencing using private reference counters.
+  The nodes whose counters drop to zero belong to the MFFC.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_LibCutMffcThr_rec( Dar_LibThr_t * pThr, Aig_Obj_t * pObj, int nLeaves )
+{
+    Aig_Obj_t * pFanin;
+    int i, k, Counter = 1;
+    for ( i = 0; i < 2; i++ )
+    {
+        pFanin = i ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+        if ( !Aig_ObjIsNode(pFanin) )
+            continue;
+        for ( k = 0; k < nLeaves; k++ )
+            if ( Aig_Regular(pThr->pDatas[k].pFunc) == pFanin )
+                break;
+        if ( k < nLeaves )
+            continue;
+        k = Vec_PtrFind( pThr->vMffc, pFanin );
+        if ( k == -1 )
+        {
+            k = Vec_PtrSize( pThr->vMffc );
+            Vec_PtrPush( pThr->vMffc, pFanin );
+            Vec_IntPush( pThr->vRefs, pFanin->nRefs );
+        }
+        assert( Vec_IntEntry(pThr->vRefs, k) > 0 );
+        Vec_IntAddToEntry( pThr->vRefs, k, -1 );
+        if ( Vec_IntEntry(pThr->vRefs, k) == 0 )
+            Counter += Dar_LibCutMffcThr_rec( pThr, pFanin, nLeaves );
+    }
+    return Counter;
+}
+int Dar_LibCutMffcThr( Dar_LibThr_t * pThr, Aig_Obj_t * pRoot, int nLeaves )
+{
+    Vec_PtrClear( pThr->vMffc );
+    Vec_IntClear( pThr->vRefs );
+    Vec_PtrPush( pThr->vMffc, pRoot );
+    Vec_IntPush( pThr->vRefs, 0 );
+    return Dar_LibCutMffcThr_rec( pThr, pRoot, nLeaves );
+}
+static inline int Dar_LibObjIsMffcThr( Dar_LibThr_t * pThr, Aig_Obj_t * pObj )
+{
+    int k = Vec_PtrFind( pThr->vMffc, pObj );
+    return k >= 0 && Vec_IntEntry(pThr->vRefs, k) == 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the AND node without using the ghost object.]
+
+  Description [Same as Aig_TableLookupTwo() but the ghost is on the stack.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Obj_t * Dar_LibTableLookupThr( Aig_Man_t * p, Aig_Obj_t * pFanin0, Aig_Obj_t * pFanin1 )
+{
+    Aig_Obj_t Ghost;
+    if ( pFanin0 == pFanin1 )
+        return pFanin0;
+    if ( pFanin0 == Aig_Not(pFanin1) )
+        return Aig_ManConst0(p);
+    if ( Aig_Regular(pFanin0) == Aig_ManConst1(p) )
+        return pFanin0 == Aig_ManConst1(p) ? pFanin1 : Aig_ManConst0(p);
+    if ( Aig_Regular(pFanin1) == Aig_ManConst1(p) )
+        return pFanin1 == Aig_ManConst1(p) ? pFanin0 : Aig_ManConst0(p);
+    memset( &Ghost, 0, sizeof(Aig_Obj_t) );
+    Ghost.Type = AIG_OBJ_AND;
+    if ( Aig_Regular(pFanin0)->Id < Aig_Regular(pFanin1)->Id )
+        Ghost.pFanin0 = pFanin0, Ghost.pFanin1 = pFanin1;
+    else
+        Ghost.pFanin0 = pFanin1, Ghost.pFanin1 = pFanin0;
+    return Aig_TableLookup( p, &Ghost );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns numbers to the nodes of one class.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibEvalAssignNumsThr( Dar_Man_t * p, Dar_LibThr_t * pThr, int Class, Aig_Obj_t * pRoot )
+{
+    Dar_LibObj_t * pObj;
+    Dar_LibDat_t * pData, * pData0, * pData1;
+    Aig_Obj_t * pFanin0, * pFanin1;
+    int i, iObj;
+    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    {
+        // get one class node, assign its temporary number and set its data
+        iObj = s_DarLib->pNodes0[Class][i];
+        pObj = Dar_LibObj(s_DarLib, iObj);
+        pThr->pNums[iObj] = 4 + i;
+        pData = pThr->pDatas + 4 + i;
+        pData->fMffc = 0;
+        pData->pFunc = NULL;
+        pData->TravId = 0xFFFF;
+
+        // explore the fanins
+        pData0 = pThr->pDatas + pThr->pNums[pObj->Fan0];
+        pData1 = pThr->pDatas + pThr->pNums[pObj->Fan1];
+        pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
+        if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
+            continue;
+        pFanin0 = Aig_NotCond( pData0->pFunc, pObj->fCompl0 );
+        pFanin1 = Aig_NotCond( pData1->pFunc, pObj->fCompl1 );
+        if ( Aig_Regular(pFanin0) == pRoot || Aig_Regular(pFanin1) == pRoot )
+            continue;
+        pData->pFunc = Dar_LibTableLookupThr( p->pAig, pFanin0, pFanin1 );
+        if ( pData->pFunc )
+        {
+            // update the level to be more accurate
+            pData->Level = Aig_Regular(pData->pFunc)->Level;
+            // mark the node if it is part of MFFC
+            pData->fMffc = Dar_LibObjIsMffcThr( pThr, Aig_Regular(pData->pFunc) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates one cut.]
+
+  Description [Returns the best gain.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_LibEvalThr_rec( Dar_LibThr_t * pThr, Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required )
+{
+    Dar_LibDat_t * pData;
+    int Area;
+    pData = pThr->pDatas + pThr->pNums[pObj - s_DarLib->pObjs];
+    if ( pData->TravId == Out )
+        return 0;
+    pData->TravId = Out;
+    if ( pObj->fTerm )
+        return 0;
+    if ( pData->Level > Required )
+        return 0xff;
+    if ( pData->pFunc && !pData->fMffc )
+        return 0;
+    // this is a new node - get a bound on the area of its branches
+    nNodesSaved--;
+    Area = Dar_LibEvalThr_rec( pThr, Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1 );
+    if ( Area > nNodesSaved )
+        return 0xff;
+    Area += Dar_LibEvalThr_rec( pThr, Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1 );
+    if ( Area > nNodesSaved )
+        return 0xff;
+    return Area + 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates one cut using the per-thread data.]
+
+  Description [Works as Dar_LibEval() without power-aware evaluation.
+  Instead of the leaves, records the cut giving the best gain, which
+  can be later re-evaluated by Dar_LibEval() before rewriting. If vObs
+  is given, adds to it pairs (ID, reference counter) for the nodes whose
+  references were used to compute MFFC, and pairs (ID, -1) for the leaves,
+  which should only exist for the result to remain valid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibEvalThr( Dar_Man_t * p, Dar_LibThr_t * pThr, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, Dar_Cut_t * pCutBest, Vec_Int_t * vObs )
+{
+    Dar_LibObj_t * pObj;
+    Dar_LibDat_t * pData;
+    Aig_Obj_t * pNode;
+    int i, Out, Class, nNodesSaved, nNodesAdded, nNodesGained;
+    assert( !p->pPars->fPower );
+    if ( pCut->nLeaves != 4 )
+        return;
+    // check if the cut exits and assigns leaves and their levels
+    if ( !Dar_LibCutMatchThr(p, pThr, pCut) )
+        return;
+    // collect MFFC of the node
+    nNodesSaved = Dar_LibCutMffcThr( pThr, pRoot, pCut->nLeaves );
+    // remember what the evaluation depends on
+    if ( vObs )
+    {
+        Vec_PtrForEachEntryStart( Aig_Obj_t *, pThr->vMffc, pNode, i, 1 )
+            Vec_IntPushTwo( vObs, pNode->Id, pNode->nRefs );
+        for ( i = 0; i < (int)pCut->nLeaves; i++ )
+            if ( !Aig_ObjIsConst1(Aig_Regular(pThr->pDatas[i].pFunc)) )
+                Vec_IntPushTwo( vObs, Aig_Regular(pThr->pDatas[i].pFunc)->Id, -1 );
+    }
+    // evaluate the cut
+    Class = s_DarLib->pMap[pCut->uTruth];
+    Dar_LibEvalAssignNumsThr( p, pThr, Class, pRoot );
+    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
+    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
+    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+    {
+        pObj  = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
+        pData = pThr->pDatas + pThr->pNums[s_DarLib->pSubgr0[Class][Out]];
+        if ( Aig_Regular(pData->pFunc) == pRoot )
+            continue;
+        nNodesAdded = Dar_LibEvalThr_rec( pThr, pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required );
+        nNodesGained = nNodesSaved - nNodesAdded;
+        if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
+            continue;
+        if ( nNodesGained <  p->GainBest || 
+            (nNodesGained == p->GainBest && pData->Level >= p->LevelBest) )
+            continue;
+        // remember this possibility
+        *pCutBest     = *pCut;
+        p->OutBest    = s_DarLib->pSubgr0[Class][Out];
+        p->OutNumBest = Out;
+        p->LevelBest  = pData->Level;
+        p->GainBest   = nNodesGained;
+        p->ClassBest  = Class;
+        assert( p->LevelBest <= Required );
+    }
+}
+
 
 
 
@@ -105,6 +105,8 @@ void Dar_ManPrintStats( Dar_Man_t * p )
 
     printf( "Bufs = %5d. BufMax = %5d. BufReplace = %6d. BufFix = %6d.  Levels = %4d.\n", 
         Aig_ManBufNum(p->pAig), p->pAig->nBufMax, p->pAig->nBufReplaces, p->pAig->nBufFixes, Aig_ManLevels(p->pAig) );
+    if ( p->pPars->nThreads > 1 )
+        printf( "Threads = %d. Conflicts = %d. Serial = %d.\n", p->pPars->nThreads, p->nConflicts, p->nNodesSerial );
     ABC_PRT( "Cuts  ", p->timeCuts );
     ABC_PRT( "Eval  ", p->timeEval );
     ABC_PRT( "Other ", p->timeOther );
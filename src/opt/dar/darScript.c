@@ -233,6 +233,23 @@ Aig_Man_t * Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
 
 ***********************************************************************/
 Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+{
+    return Dar_ManCompress2Mt( pAig, fBalance, fUpdateLevel, fFanout, fPower, 0, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reproduces script "compress2" with multithreaded rewriting.]
+
+  Description [Rewriting evaluates the cuts on nThreads threads 
+  (0 = serial).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManCompress2Mt( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 //alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -247,6 +264,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUpdateLevel = fUpdateLevel;
     pParsRwr->fFanout = fFanout;
     pParsRwr->fPower = fPower;
+    pParsRwr->nThreads = nThreads;
 
     pParsRwr->fVerbose = 0;//fVerbose;
     pParsRef->fVerbose = 0;//fVerbose;
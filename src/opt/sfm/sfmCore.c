@@ -20,6 +20,16 @@
 
 #include "sfmInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -51,6 +61,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nThreads     =    1;  // the number of threads for resubstitution
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -210,17 +221,22 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed by the caller
+    if ( p->fDelayUpdate )
+    {
+        p->iUpdFanin   = f;
+        p->iUpdDivisor = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth   = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
     return 1;
  }
-int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
+int Sfm_NodeResubWindow( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
-    p->nNodesTried++;
     // prepare SAT solver
-    if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
-        return 0;
     if ( !Sfm_NtkWindowToSolver( p ) )
         return 0;
     // try replacing area critical fanins
@@ -251,6 +267,13 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
 */
     return 0;
 }
+int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
+{
+    p->nNodesTried++;
+    if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
+        return 0;
+    return Sfm_NodeResubWindow( p, iNode );
+}
 
 /**Function*************************************************************
 
@@ -279,6 +302,332 @@ void Sfm_NtkPrint( Sfm_Ntk_t * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Worker copies of the network used for parallel resubstitution.]
+
+  Description [The worker shares the network with the manager, which 
+  does not change while the workers are running, and has its own window, 
+  SAT solver, variable maps and statistics.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_NtkWorkerStart( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pW = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    *pW = *p;
+    memset( &pW->vId2Var, 0, sizeof(Vec_Int_t) );
+    memset( &pW->vVar2Id, 0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pW->vId2Var, 2*p->nObjs, -1 );
+    Vec_IntFill( &pW->vVar2Id, 2*p->nObjs, -1 );
+    pW->nSatVars     = 0;
+    pW->vNodes       = Vec_IntAlloc( 1000 );
+    pW->vDivs        = Vec_IntAlloc( 100 );
+    pW->vRoots       = Vec_IntAlloc( 1000 );
+    pW->vTfo         = Vec_IntAlloc( 1000 );
+    pW->vDivCexes    = Vec_WrdStart( p->pPars->nWinSizeMax );
+    pW->vOrder       = Vec_IntAlloc( 100 );
+    pW->vDivVars     = Vec_IntAlloc( 100 );
+    pW->vDivIds      = Vec_IntAlloc( 1000 );
+    pW->vLits        = Vec_IntAlloc( 100 );
+    pW->vValues      = Vec_IntAlloc( 100 );
+    pW->vClauses     = Vec_WecAlloc( 100 );
+    pW->vFaninMap    = Vec_IntAlloc( 10 );
+    pW->pSat         = sat_solver_new();
+    sat_solver_setnvars( pW->pSat, p->pPars->nWinSizeMax );
+    pW->fDelayUpdate = 1;
+    // statistics
+    pW->nTryRemoves  = pW->nTryResubs = pW->nRemoves = pW->nResubs = 0;
+    pW->nSatCalls    = pW->nTimeOuts  = 0;
+    pW->timeCnf      = pW->timeSat    = 0;
+    return pW;
+}
+static void Sfm_NtkWorkerStop( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    // transfer statistics
+    p->nTryRemoves += pW->nTryRemoves;
+    p->nTryResubs  += pW->nTryResubs;
+    p->nRemoves    += pW->nRemoves;
+    p->nResubs     += pW->nResubs;
+    p->nSatCalls   += pW->nSatCalls;
+    p->nTimeOuts   += pW->nTimeOuts;
+    p->timeCnf     += pW->timeCnf;
+    p->timeSat     += pW->timeSat;
+    ABC_FREE( pW->vId2Var.pArray );
+    ABC_FREE( pW->vVar2Id.pArray );
+    Vec_IntFree( pW->vNodes );
+    Vec_IntFree( pW->vDivs  );
+    Vec_IntFree( pW->vRoots );
+    Vec_IntFree( pW->vTfo   );
+    Vec_WrdFree( pW->vDivCexes );
+    Vec_IntFree( pW->vOrder );
+    Vec_IntFree( pW->vDivVars );
+    Vec_IntFree( pW->vDivIds );
+    Vec_IntFree( pW->vLits  );
+    Vec_IntFree( pW->vValues );
+    Vec_WecFree( pW->vClauses );
+    Vec_IntFree( pW->vFaninMap );
+    sat_solver_delete( pW->pSat );
+    ABC_FREE( pW );
+}
+static void Sfm_NtkWorkerLoad( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    // copy the window computed by the manager
+    pW->iPivotNode = p->iPivotNode;
+    Vec_IntClear( pW->vNodes );  Vec_IntAppend( pW->vNodes, p->vNodes );
+    Vec_IntClear( pW->vDivs  );  Vec_IntAppend( pW->vDivs,  p->vDivs  );
+    Vec_IntClear( pW->vRoots );  Vec_IntAppend( pW->vRoots, p->vRoots );
+    Vec_IntClear( pW->vTfo   );  Vec_IntAppend( pW->vTfo,   p->vTfo   );
+    Vec_IntClear( pW->vOrder );  Vec_IntAppend( pW->vOrder, p->vOrder );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Speculative parallel resubstitution.]
+
+  Description [Nodes are taken in the topological order. The manager 
+  computes the windows of a batch of nodes, one window per thread, and 
+  the windows are solved at the same time, each by its own worker with 
+  its own SAT solver. The updates found are then performed by the manager 
+  in the topological order. An update changes the fanins of the node and 
+  removes its MFFC, so a result is valid only if its window does not 
+  overlap with the nodes changed by the earlier updates of the batch; 
+  otherwise the result is dropped and the node is tried again in the 
+  next batch. A node that was updated is also tried again, as in the 
+  sequential flow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkNodeIsCand( Sfm_Ntk_t * p, int i )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
+        return 0;
+    return 1;
+}
+static void Sfm_NtkCollectChanged( Sfm_Ntk_t * p, Sfm_Ntk_t * pW, int iNode, Vec_Int_t * vChanged )
+{
+    int i, iFanin;
+    // the node, its new fanin, and the fanins it loses (all of them if it becomes a constant)
+    Vec_IntFill( vChanged, 1, iNode );
+    if ( pW->iUpdDivisor != -1 )
+        Vec_IntPush( vChanged, pW->iUpdDivisor );
+    if ( pW->uUpdTruth == 0 || ~pW->uUpdTruth == 0 )
+        Sfm_ObjForEachFanin( p, iNode, iFanin, i )
+            Vec_IntPush( vChanged, iFanin );
+    else
+        Vec_IntPush( vChanged, Sfm_ObjFanin(p, iNode, pW->iUpdFanin) );
+}
+static void Sfm_NtkMarkChanged( Sfm_Ntk_t * p, Sfm_Ntk_t * pW, Vec_Int_t * vChanged, Vec_Int_t * vMarks, int Stamp )
+{
+    int i, iTemp;
+    // the removed nodes are in the TFI of the node
+    Vec_IntForEachEntry( pW->vNodes, iTemp, i )
+        if ( !Sfm_ObjIsPi(p, iTemp) && Sfm_ObjFaninNum(p, iTemp) == 0 && Sfm_ObjFanoutNum(p, iTemp) == 0 )
+            Vec_IntWriteEntry( vMarks, iTemp, Stamp );
+    // the changed nodes and their TFO as far as the windows reach
+    Sfm_NtkWindowMarkTfo( p, vChanged, vMarks, Stamp );
+}
+int Sfm_NtkUseMt( Sfm_Ntk_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    // detailed printouts compute MFFCs, which temporarily change the network
+    return p->pPars->nThreads > 1 && !p->pPars->fVeryVerbose;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+#define SFM_THR_MAX 100
+typedef struct Sfm_ThPool_t_
+{
+    int             nJobs;      // the number of windows in the batch
+    int             iRound;     // the number of batches posted
+    int             nBusy;      // the number of threads still working
+    int             fStop;      // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;  // signals the threads about a new batch
+    pthread_cond_t  CondDone;   // signals the main thread about completion
+} Sfm_ThPool_t;
+typedef struct Sfm_ThData_t_
+{
+    Sfm_ThPool_t * pPool;
+    Sfm_Ntk_t *    pW;
+    int            iThread;
+    int            iNode;
+    int            RetValue;
+} Sfm_ThData_t;
+void * Sfm_WorkerThread( void * pArg )
+{
+    Sfm_ThData_t * pThData = (Sfm_ThData_t *)pArg;
+    Sfm_ThPool_t * pPool = pThData->pPool;
+    int iRound = 0, nJobs, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        nJobs  = pPool->nJobs;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        if ( pThData->iThread >= nJobs )
+            continue;
+        pThData->RetValue = Sfm_NodeResubWindow( pThData->pW, pThData->iNode );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+int Sfm_NtkPerformMt( Sfm_Ntk_t * p )
+{
+    pthread_t WorkerThread[SFM_THR_MAX];
+    Sfm_ThData_t ThData[SFM_THR_MAX];
+    Sfm_ThPool_t Pool, * pPool = &Pool;
+    Sfm_Ntk_t * pW;
+    Vec_Int_t * vMarks   = Vec_IntStart( p->nObjs );
+    Vec_Int_t * vPending = Vec_IntAlloc( 100 );
+    Vec_Int_t * vNext    = Vec_IntAlloc( 100 );
+    Vec_Int_t * vUpdated = Vec_IntAlloc( 10 );
+    Vec_Str_t * vChanged = Vec_StrStart( p->nObjs );
+    int nThreads = Abc_MinInt( p->pPars->nThreads, SFM_THR_MAX );
+    int i, k, iNode, iPend, nJobs, status, Stamp, Counter = 0;
+    int iNext = p->nPis, iLast = p->nObjs - p->nPos;
+    // start the threads (the first window of each batch is solved by this thread)
+    memset( pPool, 0, sizeof(Sfm_ThPool_t) );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pPool    = pPool;
+        ThData[i].pW       = Sfm_NtkWorkerStart( p );
+        ThData[i].iThread  = i;
+        ThData[i].iNode    = -1;
+        ThData[i].RetValue = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, Sfm_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( Stamp = 1; ; Stamp++ )
+    {
+        // collect the windows of the next nodes (the nodes to be tried again go first)
+        nJobs = iPend = 0;
+        while ( nJobs < nThreads )
+        {
+            if ( iPend < Vec_IntSize(vPending) )
+                iNode = Vec_IntEntry( vPending, iPend++ );
+            else if ( iNext < iLast )
+                iNode = iNext++;
+            else
+                break;
+            if ( !Sfm_NtkNodeIsCand(p, iNode) )
+                continue;
+            p->nNodesTried++;
+            if ( !Sfm_NtkCreateWindow(p, iNode, 0) )
+                continue;
+            Sfm_NtkWorkerLoad( p, ThData[nJobs].pW );
+            ThData[nJobs++].iNode = iNode;
+        }
+        if ( nJobs == 0 )
+            break;
+        Vec_IntClear( vNext );
+        Vec_IntForEachEntryStart( vPending, iNode, i, iPend )
+            Vec_IntPush( vNext, iNode );
+        // solve the windows
+        if ( nJobs > 1 )
+        {
+            pthread_mutex_lock( &pPool->Mutex );
+            pPool->nJobs = nJobs;
+            pPool->nBusy = nJobs - 1;
+            pPool->iRound++;
+            pthread_cond_broadcast( &pPool->CondStart );
+            pthread_mutex_unlock( &pPool->Mutex );
+        }
+        ThData[0].RetValue = Sfm_NodeResubWindow( ThData[0].pW, ThData[0].iNode );
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+        // perform the updates in the topological order
+        Vec_IntClear( vPending );
+        for ( k = 0; k < nJobs; k++ )
+        {
+            int kBest = -1;
+            for ( i = 0; i < nJobs; i++ )
+                if ( ThData[i].iNode >= 0 && (kBest == -1 || ThData[i].iNode < ThData[kBest].iNode) )
+                    kBest = i;
+            pW = ThData[kBest].pW;
+            iNode = ThData[kBest].iNode;
+            ThData[kBest].iNode = -1;
+            // the window was changed by an earlier update
+            if ( Sfm_NtkWindowOverlap(pW, vMarks, Stamp) )
+            {
+                if ( ThData[kBest].RetValue && pW->iUpdDivisor == -1 )
+                    pW->nRemoves--;
+                else if ( ThData[kBest].RetValue )
+                    pW->nResubs--;
+                Vec_IntPush( vPending, iNode );
+                continue;
+            }
+            if ( !ThData[kBest].RetValue )
+                continue;
+            Sfm_NtkCollectChanged( p, pW, iNode, vUpdated );
+            Sfm_NtkUpdate( p, iNode, pW->iUpdFanin, pW->iUpdDivisor, pW->uUpdTruth );
+            Sfm_NtkMarkChanged( p, pW, vUpdated, vMarks, Stamp );
+            if ( !Vec_StrEntry(vChanged, iNode) )
+                Counter++;
+            Vec_StrWriteEntry( vChanged, iNode, 1 );
+            Vec_IntPush( vPending, iNode );
+        }
+        Vec_IntAppend( vPending, vNext );
+        if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            break;
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( i > 0 )
+            pthread_join( WorkerThread[i], NULL );
+        Sfm_NtkWorkerStop( p, ThData[i].pW );
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    Vec_IntFree( vMarks );
+    Vec_IntFree( vPending );
+    Vec_IntFree( vNext );
+    Vec_IntFree( vUpdated );
+    Vec_StrFree( vChanged );
+    return Counter;
+}
+
+#else // pthreads are not used
+
+int Sfm_NtkPerformMt( Sfm_Ntk_t * p ) { return 0; }
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -308,22 +657,23 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode( p, i )
+    if ( Sfm_NtkUseMt(p) )
+        Counter = Sfm_NtkPerformMt( p );
+    else
     {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
-            continue;
-        for ( k = 0; Sfm_NodeResub(p, i); k++ )
+        Sfm_NtkForEachNode( p, i )
         {
+            if ( !Sfm_NtkNodeIsCand(p, i) )
+                continue;
+            for ( k = 0; Sfm_NodeResub(p, i); k++ )
+            {
 //            Counter++;
 //            break;
+            }
+            Counter += (k > 0);
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                break;
         }
-        Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
-            break;
     }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
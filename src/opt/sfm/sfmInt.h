@@ -113,6 +113,11 @@ struct Sfm_Ntk_t_
     // counter-examples
     int               nCexes;      // number of CEXes
     Vec_Wrd_t *       vDivCexes;   // counter-examples
+    // delayed update (used by the worker threads)
+    int               fDelayUpdate;// record the update instead of performing it
+    int               iUpdFanin;   // the fanin to be replaced
+    int               iUpdDivisor; // the new fanin (-1 if the fanin is removed)
+    word              uUpdTruth;   // the new function of the node
     // intermediate data
     Vec_Int_t *       vOrder;      // object order
     Vec_Int_t *       vDivVars;    // divisor SAT variables
@@ -245,6 +250,8 @@ extern int          Sfm_MitEvalRemapping( Sfm_Mit_t * p, Vec_Int_t * vMffc, Abc_
 /*=== sfmWin.c ==========================================================*/
 extern int          Sfm_ObjMffcSize( Sfm_Ntk_t * p, int iObj );
 extern int          Sfm_NtkCreateWindow( Sfm_Ntk_t * p, int iNode, int fVerbose );
+extern int          Sfm_NtkWindowOverlap( Sfm_Ntk_t * p, Vec_Int_t * vMarks, int Stamp );
+extern void         Sfm_NtkWindowMarkTfo( Sfm_Ntk_t * p, Vec_Int_t * vNodes, Vec_Int_t * vMarks, int Stamp );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -465,6 +465,62 @@ int Sfm_NtkCreateWindow( Sfm_Ntk_t * p, int iNode, int fVerbose )
     printf( "\n" );
     return 1;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the current window contains changed nodes.]
+
+  Description [The nodes whose fanins were changed are marked by Stamp 
+  in vMarks. Returns 1 if the window contains such a node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkWindowOverlap( Sfm_Ntk_t * p, Vec_Int_t * vMarks, int Stamp )
+{
+    int i, iTemp;
+    Vec_IntForEachEntry( p->vOrder, iTemp, i )
+        if ( !Sfm_ObjIsPi(p, iTemp) && Vec_IntEntry(vMarks, iTemp) == Stamp )
+            return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the nodes and their TFO that a window may include.]
+
+  Description [The TFO is marked up to nTfoLevMax levels above the 
+  highest of the nodes, which is as far as a window reaches when it
+  collects its roots.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkWindowMarkTfo_rec( Sfm_Ntk_t * p, int iNode, int nLevelMax, Vec_Int_t * vMarks, int Stamp )
+{
+    int i, iFanout;
+    if ( Sfm_ObjIsTravIdCurrent(p, iNode) )
+        return;
+    Sfm_ObjSetTravIdCurrent( p, iNode );
+    Vec_IntWriteEntry( vMarks, iNode, Stamp );
+    if ( Sfm_ObjLevel(p, iNode) >= nLevelMax )
+        return;
+    Sfm_ObjForEachFanout( p, iNode, iFanout, i )
+        Sfm_NtkWindowMarkTfo_rec( p, iFanout, nLevelMax, vMarks, Stamp );
+}
+void Sfm_NtkWindowMarkTfo( Sfm_Ntk_t * p, Vec_Int_t * vNodes, Vec_Int_t * vMarks, int Stamp )
+{
+    int i, iNode, nLevelMax = 0;
+    Vec_IntForEachEntry( vNodes, iNode, i )
+        nLevelMax = Abc_MaxInt( nLevelMax, Sfm_ObjLevel(p, iNode) + p->pPars->nTfoLevMax );
+    Sfm_NtkIncrementTravId( p );
+    Vec_IntForEachEntry( vNodes, iNode, i )
+        Sfm_NtkWindowMarkTfo_rec( p, iNode, nLevelMax, vMarks, Stamp );
+}
 void Sfm_NtkWindowTest( Sfm_Ntk_t * p, int iNode )
 {
     int i;
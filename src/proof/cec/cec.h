@@ -52,6 +52,7 @@ struct Cec_ParSat_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
     int              fSaveCexes;    // saves counter-examples
+    int              nThreads;      // the number of cooperating solvers
     int              fVerbose;      // verbose stats
 };
 
@@ -102,6 +103,7 @@ struct Cec_ParFra_t_
     int              TimeLimit;     // the runtime limit in seconds
     int              nLevelMax;     // restriction on the level nodes to be swept
     int              nDepthMax;     // the depth in terms of steps of speculative reduction
+    int              nThreads;      // the number of SAT solving or simulation threads
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -20,6 +20,17 @@
 
 #include "cecInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -922,6 +933,367 @@ int Cec_ManSimClassesRefine( Cec_ManSim_t * p )
         Gia_ManEquivPrintClasses( p->pAig, 0, Cec_MemUsage(p) );
     return 0;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AIG for one slice of patterns.]
+
+  Description [The simulation info of each object takes nWords words. 
+  The info of the CIs is assigned by the caller. The info of the COs 
+  is computed, too, to be used in checking the miter outputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSimMtSimulate( Gia_Man_t * pAig, unsigned * pSims, int nWords )
+{
+    Gia_Obj_t * pObj;
+    unsigned * pRes, * pRes0, * pRes1;
+    int i, w;
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        pRes  = pSims + i * nWords;
+        pRes0 = pSims + Gia_ObjFaninId0(pObj, i) * nWords;
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Gia_ObjFaninC0(pObj) )
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = ~pRes0[w];
+            else
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = pRes0[w];
+            continue;
+        }
+        pRes1 = pSims + Gia_ObjFaninId1(pObj, i) * nWords;
+        if ( Gia_ObjFaninC0(pObj) )
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = ~(pRes0[w] | pRes1[w]);
+            else
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = ~pRes0[w] & pRes1[w];
+        }
+        else
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = pRes0[w] & ~pRes1[w];
+            else
+                for ( w = 0; w < nWords; w++ )
+                    pRes[w] = pRes0[w] & pRes1[w];
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the simulation info of two nodes in all slices.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManSimMtEqual( unsigned ** ppSims, int nSlices, int nWords, int i, int k )
+{
+    int t;
+    for ( t = 0; t < nSlices; t++ )
+        if ( !Cec_ManSimCompareEqual( ppSims[t] + i * nWords, ppSims[t] + k * nWords, nWords ) )
+            return 0;
+    return 1;
+}
+static inline int Cec_ManSimMtConst( unsigned ** ppSims, int nSlices, int nWords, int i )
+{
+    int t;
+    for ( t = 0; t < nSlices; t++ )
+        if ( !Cec_ManSimCompareConst( ppSims[t] + i * nWords, nWords ) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines one equivalence class using all slices.]
+
+  Description [Works the same way as Cec_ManSimClassRefineOne().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimMtRefineOne( Cec_ManSim_t * p, unsigned ** ppSims, int nSlices, int i )
+{
+    int Ent;
+    Vec_IntClear( p->vClassOld );
+    Vec_IntClear( p->vClassNew );
+    Vec_IntPush( p->vClassOld, i );
+    Gia_ClassForEachObj1( p->pAig, i, Ent )
+    {
+        if ( Cec_ManSimMtEqual( ppSims, nSlices, p->nWords, i, Ent ) )
+            Vec_IntPush( p->vClassOld, Ent );
+        else
+            Vec_IntPush( p->vClassNew, Ent );
+    }
+    if ( Vec_IntSize( p->vClassNew ) == 0 )
+        return 0;
+    Cec_ManSimClassCreate( p->pAig, p->vClassOld );
+    Cec_ManSimClassCreate( p->pAig, p->vClassNew );
+    if ( Vec_IntSize(p->vClassNew) > 1 )
+        return 1 + Cec_ManSimMtRefineOne( p, ppSims, nSlices, Vec_IntEntry(p->vClassNew,0) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines all equivalence classes using all slices.]
+
+  Description [The classes are visited in the order of object IDs and 
+  the slices in the order of threads, so the result does not depend on 
+  which thread finished first. Nodes dropped from the constant class 
+  are grouped by hashing, as in Cec_ManSimProcessRefined().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSimMtRefine( Cec_ManSim_t * p, unsigned ** ppSims, int nSlices )
+{
+    int * pTable, nTableSize, i, k, t, Key;
+    Gia_ManForEachClass( p->pAig, i )
+        Cec_ManSimMtRefineOne( p, ppSims, nSlices, i );
+    // collect nodes that are no longer constant
+    Vec_IntClear( p->vRefinedC );
+    for ( i = 1; i < Gia_ManObjNum(p->pAig); i++ )
+        if ( Gia_ObjIsConst(p->pAig, i) && !Cec_ManSimMtConst( ppSims, nSlices, p->nWords, i ) )
+            Vec_IntPush( p->vRefinedC, i );
+    if ( Vec_IntSize(p->vRefinedC) == 0 )
+        return;
+    nTableSize = Abc_PrimeCudd( 100 + Vec_IntSize(p->vRefinedC) / 3 );
+    pTable = ABC_CALLOC( int, nTableSize );
+    Vec_IntForEachEntry( p->vRefinedC, i, k )
+    {
+        for ( Key = t = 0; t < nSlices; t++ )
+            Key = (Key + Cec_ManSimHashKey( ppSims[t] + i * p->nWords, p->nWords, nTableSize )) % nTableSize;
+        assert( Gia_ObjNext(p->pAig, i) == 0 );
+        if ( pTable[Key] == 0 )
+            Gia_ObjSetRepr( p->pAig, i, GIA_VOID );
+        else
+        {
+            Gia_ObjSetNext( p->pAig, pTable[Key], i );
+            Gia_ObjSetRepr( p->pAig, i, Gia_ObjRepr(p->pAig, pTable[Key]) );
+            if ( Gia_ObjRepr(p->pAig, i) == GIA_VOID )
+                Gia_ObjSetRepr( p->pAig, i, pTable[Key] );
+        }
+        pTable[Key] = i;
+    }
+    Vec_IntForEachEntry( p->vRefinedC, i, k )
+        if ( Gia_ObjIsHead( p->pAig, i ) )
+            Cec_ManSimMtRefineOne( p, ppSims, nSlices, i );
+    Vec_IntClear( p->vRefinedC );
+    ABC_FREE( pTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the miter outputs in all slices.]
+
+  Description [Returns 1 if an output is disproved. The first failing 
+  pattern is taken from the lowest slice, as it would be if the slices 
+  were simulated one after another.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimMtAnalyzeOutputs( Cec_ManSim_t * p, unsigned ** ppSims, int nSlices )
+{
+    Gia_Obj_t * pObj;
+    int i, t;
+    if ( !p->pPars->fCheckMiter )
+        return 0;
+    for ( t = 0; t < nSlices; t++ )
+    {
+        Gia_ManForEachCi( p->pAig, pObj, i )
+            memcpy( Vec_PtrEntry(p->vCiSimInfo, i), ppSims[t] + Gia_ObjId(p->pAig, pObj) * p->nWords, sizeof(unsigned) * p->nWords );
+        Gia_ManForEachCo( p->pAig, pObj, i )
+            memcpy( Vec_PtrEntry(p->vCoSimInfo, i), ppSims[t] + Gia_ObjId(p->pAig, pObj) * p->nWords, sizeof(unsigned) * p->nWords );
+        Cec_ManSimAnalyzeOutputs( p );
+    }
+    return p->pCexes != NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using several simulation threads.]
+
+  Description [Each round, every thread simulates its own slice of 
+  random patterns, with nWords words per slice, and the classes are 
+  refined using all the slices together. The patterns are generated 
+  in the order of the slices before the threads start, so the result 
+  does not depend on the number of threads that actually run at the 
+  same time. The rounds continue until the number of candidate 
+  equivalences stops decreasing or the limit on rounds is reached. 
+  Each thread keeps the simulation info of all objects, which takes 
+  4*nWords bytes per object. Returns 1 if the bug is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Cec_ManSimClassesRefineMt( Cec_ManSim_t * p, int nThreads )
+{
+    return 0;
+}
+
+#else // pthreads are used
+
+#define CEC_SIM_THR_MAX 100
+typedef struct Cec_SimThPool_t_
+{
+    int             iRound;     // the number of rounds posted
+    int             nBusy;      // the number of threads still working
+    int             fStop;      // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;  // signals the threads about a new round
+    pthread_cond_t  CondDone;   // signals the main thread about completion
+} Cec_SimThPool_t;
+typedef struct Cec_SimThData_t_
+{
+    pthread_t    Thread;
+    Cec_SimThPool_t * pPool;
+    Gia_Man_t *  pAig;
+    unsigned *   pSims;
+    int          nWords;
+} Cec_SimThData_t;
+void * Cec_ManSimWorkerThread( void * pArg )
+{
+    Cec_SimThData_t * pThData = (Cec_SimThData_t *)pArg;
+    Cec_SimThPool_t * pPool = pThData->pPool;
+    int iRound = 0, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        Cec_ManSimMtSimulate( pThData->pAig, pThData->pSims, pThData->nWords );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+int Cec_ManSimClassesRefineMt( Cec_ManSim_t * p, int nThreads )
+{
+    Cec_SimThData_t * pThData;
+    Cec_SimThPool_t Pool, * pPool = &Pool;
+    unsigned ** ppSims;
+    Gia_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int i, k, r, w, status, RetValue = 0;
+    int nLitsOld, nLitsNew, nLitsBeg;
+    assert( p->pAig->pReprs != NULL );
+    assert( !p->pPars->fSeqSimulate && !p->pPars->fLatchCorr && p->pBestState == NULL );
+    nThreads = Abc_MinInt( nThreads, CEC_SIM_THR_MAX );
+    if ( nThreads < 2 )
+        return 0;
+    p->nWords = p->pPars->nWords;
+    ppSims  = ABC_ALLOC( unsigned *, nThreads );
+    pThData = ABC_CALLOC( Cec_SimThData_t, nThreads );
+    memset( pPool, 0, sizeof(Cec_SimThPool_t) );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ppSims[i] = ABC_CALLOC( unsigned, (size_t)p->nWords * Gia_ManObjNum(p->pAig) );
+        pThData[i].pPool  = pPool;
+        pThData[i].pAig   = p->pAig;
+        pThData[i].pSims  = ppSims[i];
+        pThData[i].nWords = p->nWords;
+        status = pthread_create( &pThData[i].Thread, NULL, Cec_ManSimWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    nLitsBeg = nLitsOld = Gia_ManEquivCountLits( p->pAig );
+    for ( r = 0; r < p->pPars->nRounds; r++ )
+    {
+        // assign the patterns in the order of the slices
+        for ( i = 0; i < nThreads; i++ )
+            Gia_ManForEachCi( p->pAig, pObj, k )
+            {
+                unsigned * pSim = ppSims[i] + Gia_ObjId(p->pAig, pObj) * p->nWords;
+                for ( w = 0; w < p->nWords; w++ )
+                    pSim[w] = Gia_ManRandom( 0 );
+                // make sure the first pattern of each slice is zero, as the
+                // comparison normalizes the phase by this pattern in each slice
+                pSim[0] ^= (pSim[0] & 1);
+            }
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->nBusy = nThreads;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( Cec_ManSimMtAnalyzeOutputs( p, ppSims, nThreads ) )
+        {
+            RetValue = 1;
+            break;
+        }
+        Cec_ManSimMtRefine( p, ppSims, nThreads );
+        nLitsNew = Gia_ManEquivCountLits( p->pAig );
+        if ( p->pPars->fVeryVerbose )
+            Gia_ManEquivPrintClasses( p->pAig, 0, 0.0 );
+        if ( nLitsNew >= nLitsOld )
+        {
+            r++;
+            break;
+        }
+        nLitsOld = nLitsNew;
+    }
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pthread_join( pThData[i].Thread, NULL );
+        ABC_FREE( ppSims[i] );
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    ABC_FREE( pThData );
+    ABC_FREE( ppSims );
+    if ( p->pPars->fVerbose )
+    {
+        Abc_Print( 1, "Simulated %d rounds of %d words using %d threads. Lits: %d -> %d. ", 
+            r, p->nWords, nThreads, nLitsBeg, Gia_ManEquivCountLits(p->pAig) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return RetValue;
+}
+
+#endif // pthreads are used
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -53,6 +53,7 @@ void Cec_ManSatSetDefaultParams( Cec_ParSat_t * p )
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fLearnCls      =       0;  // perform clause learning
+    p->nThreads       =       1;  // the number of cooperating solvers
     p->fVerbose       =       0;  // verbose stats
 }  
 
@@ -132,6 +133,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->nBTLimit       =     100;  // conflict limit at a node
     p->nLevelMax      =       0;  // restriction on the level of nodes to be swept
     p->nDepthMax      =       1;  // the depth in terms of steps of speculative reduction
+    p->nThreads       =       1;  // the number of SAT solving or simulation threads
     p->fRewriting     =       0;  // enables AIG rewriting
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
@@ -236,11 +238,16 @@ Gia_Man_t * Cec_ManSatSolving( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
 {
     Gia_Man_t * pNew;
     Cec_ManPat_t * pPat;
-    pPat = Cec_ManPatStart();
-    Cec_ManSatSolve( pPat, pAig, pPars, NULL, NULL, NULL );
+    if ( pPars->nThreads > 1 )
+        Cec_ManSatSolveMt( pAig, pPars );
+    else
+    {
+        pPat = Cec_ManPatStart();
+        Cec_ManSatSolve( pPat, pAig, pPars, NULL, NULL, NULL );
+        Cec_ManPatStop( pPat );
+    }
 //    pNew = Gia_ManDupDfsSkip( pAig );
     pNew = Gia_ManDup( pAig );
-    Cec_ManPatStop( pPat );
     pNew->vSeqModelVec = pAig->vSeqModelVec;
     pAig->vSeqModelVec = NULL;
     return pNew;
@@ -386,7 +393,9 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
 clk = Abc_Clock();
     if ( p->pAig->pReprs == NULL )
     {
-        if ( Cec_ManSimClassesPrepare(pSim, -1) || Cec_ManSimClassesRefine(pSim) )
+        if ( Cec_ManSimClassesPrepare(pSim, -1) || 
+            (pPars->nThreads > 1 && Cec_ManSimClassesRefineMt(pSim, pPars->nThreads)) || 
+             Cec_ManSimClassesRefine(pSim) )
         {
             Gia_ManStop( p->pAig );
             p->pAig = NULL;
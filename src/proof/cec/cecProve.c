@@ -0,0 +1,361 @@
+/**CFile****************************************************************
+
+  FileName    [cecProve.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Portfolio of concurrently running sequential provers.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cecProve.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "aig/saig/saig.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "sat/bmc/bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the engines available in the portfolio
+typedef enum {
+    CEC_PRT_PDR = 0,   // property directed reachability
+    CEC_PRT_BMC3,      // scalable bounded model checking
+    CEC_PRT_INT,       // interpolation
+    CEC_PRT_NUM        // the number of engines
+} Cec_PrtEngine_t;
+
+static char * s_CecPrtNames[CEC_PRT_NUM] = { "pdr", "bmc3", "int" };
+
+// information given to the engine
+typedef struct Cec_PrtData_t_ Cec_PrtData_t;
+struct Cec_PrtData_t_
+{
+    Gia_Man_t *  pGia;       // private copy of the design used to check the CEX
+    Aig_Man_t *  pAig;       // private copy of the design given to the engine
+    int          Engine;     // the engine to run
+    int          nTimeOut;   // timeout in seconds
+    int          RunId;      // the id of this portfolio run
+    int          fVerbose;   // verbose flag
+    int          Result;     // the result produced by the engine
+    int          fWinner;    // set when this engine solved the problem first
+    Abc_Cex_t *  pCex;       // the verified counter-example
+    abctime      clkTotal;   // the runtime of the engine
+};
+
+#ifdef ABC_USE_PTHREADS
+// mutex to control access to shared variables
+static pthread_mutex_t s_PrtMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static volatile int s_nPrtRunIds = 0;   // the number of the last portfolio run
+
+// call back procedure used to stop the engines
+static int Cec_PrtCallBackToStop( int RunId ) { assert( RunId <= s_nPrtRunIds ); return RunId < s_nPrtRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the comma-separated list of engines.]
+
+  Description [Returns NULL if the list contains an unknown engine
+  or lists the same engine more than once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_PortfolioParseEngines( char * pEngines )
+{
+    Vec_Int_t * vEngines = Vec_IntAlloc( CEC_PRT_NUM );
+    char * pCopy = Abc_UtilStrsav( pEngines ), * pToken;
+    int i;
+    for ( pToken = strtok( pCopy, "," ); pToken; pToken = strtok( NULL, "," ) )
+    {
+        for ( i = 0; i < CEC_PRT_NUM; i++ )
+            if ( !strcmp( pToken, s_CecPrtNames[i] ) )
+                break;
+        if ( i == CEC_PRT_NUM )
+        {
+            Abc_Print( -1, "Unknown engine \"%s\" (available engines: pdr, bmc3, int).\n", pToken );
+            break;
+        }
+        if ( Vec_IntFind( vEngines, i ) >= 0 )
+        {
+            Abc_Print( -1, "Engine \"%s\" is listed more than once.\n", pToken );
+            break;
+        }
+        Vec_IntPush( vEngines, i );
+    }
+    ABC_FREE( pCopy );
+    if ( pToken != NULL || Vec_IntSize(vEngines) == 0 )
+        Vec_IntFreeP( &vEngines );
+    return vEngines;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the counter-example against the private copy.]
+
+  Description [Returns 1 if the CEX is well-formed and asserts
+  the output it points to.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_PortfolioCheckCex( Gia_Man_t * p, Abc_Cex_t * pCex )
+{
+    if ( pCex == NULL || pCex->iFrame < 0 )
+        return 0;
+    if ( pCex->nPis != Gia_ManPiNum(p) || pCex->nRegs != Gia_ManRegNum(p) )
+        return 0;
+    if ( pCex->nBits != pCex->nRegs + pCex->nPis * (pCex->iFrame + 1) )
+        return 0;
+    if ( pCex->iPo < 0 || pCex->iPo >= Gia_ManPoNum(p) )
+        return 0;
+    return Gia_ManVerifyCex( p, pCex, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine on its private copy of the design.]
+
+  Description [A definitive result is accepted only if it is the first
+  one produced in this run. Accepting it cancels the other engines.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_PortfolioSolve( Cec_PrtData_t * pData )
+{
+    Aig_Man_t * pAig = pData->pAig;
+    Abc_Cex_t * pCex = NULL;
+    int RetValue = -1, fOrPos = 0;
+    abctime clk = Abc_Clock();
+    if ( pData->Engine == CEC_PRT_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut  = pData->nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = pData->RunId;
+        pPars->pFuncStop = Cec_PrtCallBackToStop;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+    }
+    else if ( pData->Engine == CEC_PRT_BMC3 )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut  = pData->nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = pData->RunId;
+        pPars->pFuncStop = Cec_PrtCallBackToStop;
+        RetValue = Saig_ManBmcScalable( pAig, pPars );
+        if ( RetValue == 1 ) // bounded result is not a proof
+            RetValue = -1;
+    }
+    else if ( pData->Engine == CEC_PRT_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        Aig_Man_t * pTemp;
+        int iFrame = -1;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit = pData->nTimeOut;
+        pPars->RunId     = pData->RunId;
+        pPars->pFuncStop = Cec_PrtCallBackToStop;
+        // interpolation works on one output
+        if ( Saig_ManPoNum(pAig) > 1 )
+        {
+            pAig = Saig_ManDupOrpos( pTemp = pAig );
+            Aig_ManStop( pTemp );
+            pData->pAig = pAig;
+            fOrPos = 1;
+        }
+        if ( Saig_ManRegNum(pAig) > 0 && Saig_ManPiNum(pAig) > 0 )
+            RetValue = Inter_ManPerformInterpolation( pAig, pPars, &iFrame );
+    }
+    else assert( 0 );
+    // check the counter-example on the original outputs
+    if ( RetValue == 0 )
+    {
+        pCex = pAig->pSeqModel;  pAig->pSeqModel = NULL;
+        if ( pCex && fOrPos ) // find the original output that fails
+            Gia_ManSetFailedPoCex( pData->pGia, pCex );
+        if ( !Cec_PortfolioCheckCex( pData->pGia, pCex ) )
+        {
+            Abc_Print( 1, "Engine %s did not produce a valid counter-example; the result is ignored.\n", s_CecPrtNames[pData->Engine] );
+            ABC_FREE( pCex );
+            RetValue = -1;
+        }
+    }
+    // accept the first definitive result
+    if ( RetValue != -1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        int status = pthread_mutex_lock(&s_PrtMutex);  assert( status == 0 );
+#endif
+        if ( pData->RunId == s_nPrtRunIds )
+        {
+            s_nPrtRunIds++;
+            pData->fWinner = 1;
+        }
+#ifdef ABC_USE_PTHREADS
+        status = pthread_mutex_unlock(&s_PrtMutex);  assert( status == 0 );
+#endif
+    }
+    pData->Result   = RetValue;
+    pData->pCex     = pCex;
+    pData->clkTotal = Abc_Clock() - clk;
+    if ( pData->fVerbose )
+    {
+        Abc_Print( 1, "Engine %-4s : ", s_CecPrtNames[pData->Engine] );
+        if ( pData->fWinner )
+            Abc_Print( 1, "%s.  ", RetValue == 1 ? "Proved" : "Disproved" );
+        else if ( RetValue != -1 )
+            Abc_Print( 1, "%s after another engine.  ", RetValue == 1 ? "Proved" : "Disproved" );
+        else
+            Abc_Print( 1, "Undecided.  " );
+        Abc_PrintTime( 1, "Time", pData->clkTotal );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Cec_PortfolioThread( void * pArg )
+{
+    Cec_PortfolioSolve( (Cec_PrtData_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Races the engines on copies of the sequential miter.]
+
+  Description [Returns 1 if the property is proved, 0 if it is disproved
+  (in which case p->pCexSeq contains the verified counter-example), and
+  -1 if no engine could solve it. Without pthreads, the engines are run
+  one after another.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaPortfolio( Gia_Man_t * p, Vec_Int_t * vEngines, int nTimeOut, int fVerbose )
+{
+    Cec_PrtData_t * pData = ABC_CALLOC( Cec_PrtData_t, Vec_IntSize(vEngines) );
+    int i, Engine, RunId, RetValue = -1, iWinner = -1;
+    abctime clkTotal = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_t * pThreads = ABC_ALLOC( pthread_t, Vec_IntSize(vEngines) );
+    int status = pthread_mutex_lock(&s_PrtMutex);  assert( status == 0 );
+#endif
+    RunId = s_nPrtRunIds;
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock(&s_PrtMutex);  assert( status == 0 );
+#endif
+    assert( Gia_ManRegNum(p) > 0 );
+    // prepare the private copies in the main thread
+    Vec_IntForEachEntry( vEngines, Engine, i )
+    {
+        pData[i].pGia     = Gia_ManDup( p );
+        pData[i].pAig     = Gia_ManToAigSimple( pData[i].pGia );
+        pData[i].Engine   = Engine;
+        pData[i].nTimeOut = nTimeOut;
+        pData[i].RunId    = RunId;
+        pData[i].fVerbose = fVerbose;
+        pData[i].Result   = -1;
+    }
+    // run the engines
+#ifdef ABC_USE_PTHREADS
+    for ( i = 0; i < Vec_IntSize(vEngines); i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Cec_PortfolioThread, (void *)(pData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < Vec_IntSize(vEngines); i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+#else
+    for ( i = 0; i < Vec_IntSize(vEngines) && s_nPrtRunIds == RunId; i++ )
+        Cec_PortfolioSolve( pData + i );
+#endif
+    // collect the result
+    for ( i = 0; i < Vec_IntSize(vEngines); i++ )
+    {
+        // the engines run in their own threads; report the longest one
+        if ( clkTotal < pData[i].clkTotal )
+            clkTotal = pData[i].clkTotal;
+        if ( pData[i].fWinner )
+        {
+            assert( iWinner == -1 );
+            iWinner  = i;
+            RetValue = pData[i].Result;
+            if ( RetValue == 0 )
+            {
+                ABC_FREE( p->pCexSeq );
+                p->pCexSeq = pData[i].pCex;
+                pData[i].pCex = NULL;
+            }
+        }
+        ABC_FREE( pData[i].pCex );
+        Aig_ManStop( pData[i].pAig );
+        Gia_ManStop( pData[i].pGia );
+    }
+    if ( RetValue == 1 )
+        Abc_Print( 1, "Property proved by engine %s.  ", s_CecPrtNames[pData[iWinner].Engine] );
+    else if ( RetValue == 0 )
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d by engine %s.  ",
+            p->pCexSeq->iPo, p->pName ? p->pName : "", p->pCexSeq->iFrame, s_CecPrtNames[pData[iWinner].Engine] );
+    else
+        Abc_Print( 1, "Property UNDECIDED.  " );
+    Abc_PrintTime( 1, "Time", clkTotal );
+    ABC_FREE( pData );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -23,6 +23,17 @@
 #include "sat/glucose/AbcGlucose.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -39,6 +50,7 @@ struct Cec3_Par_t_
     int              nConfLimit;    // SAT solver conflict limit
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
+    int              nThreads;      // the number of SAT solving threads
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -59,6 +71,10 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    // multi-threading
+    Vec_Ptr_t *      vWorkers;       // per-thread managers
+    Vec_Int_t *      vBatch;         // nodes waiting to be solved
+    void *           pThData;        // thread data
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -104,6 +120,7 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nConfLimit     =    1000;    // conflict limit at a node
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
+    p->nThreads       =       1;    // the number of SAT solving threads
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
 }  
@@ -402,23 +419,11 @@ static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
 }
 static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Abc_SimdAnd( pSim, pSim0, Gia_ObjFaninC0(pObj), pSim1, Gia_ObjFaninC1(pObj), 0, p->nSimWords );
 }
 static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
 {
@@ -858,24 +863,30 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     return status;
 }
 
-int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+int Cec3_ManSweepNodeSolve( Cec3_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
+    return Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
+}
+int Cec3_ManSweepNodeUpdate( Cec3_Man_t * p, Cec3_Man_t * pSolver, int iObj, int status, abctime clkSolve )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, RetValue = 1;
+    int i, IdAig, IdSat, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
-    status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
     if ( status == GLUCOSE_SAT )
     {
         p->nSatSat++;
         p->nPatterns++;
         p->pAig->iPatsPi = (p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 1) ? 1 : p->pAig->iPatsPi + 1;
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
-        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
-//            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
-        p->timeSatSat += Abc_Clock() - clk;
+        Vec_IntForEachEntryDouble( pSolver->vObjSatPairs, IdAig, IdSat, i )
+//            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(pSolver->pSat, IdSat) == SATOKO_LIT_TRUE );
+            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(pSolver->pSat, IdSat) );
+        p->timeSatSat += clkSolve + Abc_Clock() - clk;
         RetValue = 0;
     }
     else if ( status == GLUCOSE_UNSAT )
@@ -883,7 +894,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
         Gia_ObjSetProved( p->pAig, iObj );
-        p->timeSatUnsat += Abc_Clock() - clk;
+        p->timeSatUnsat += clkSolve + Abc_Clock() - clk;
         RetValue = 1;
     }
     else 
@@ -891,17 +902,246 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUndec++;
         assert( status == GLUCOSE_UNDEC );
         Gia_ObjSetFailed( p->pAig, iObj );
-        p->timeSatUndec += Abc_Clock() - clk;
+        p->timeSatUndec += clkSolve + Abc_Clock() - clk;
         RetValue = 2;
     }
     if ( p->pPars->fUseCones )
         return RetValue;
     clk = Abc_Clock();
-    bmcg_sat_solver_reset( p->pSat );
+    bmcg_sat_solver_reset( pSolver->pSat );
     p->timeExtra += Abc_Clock() - clk;
-//    satoko_stats(p->pSat)->n_conflicts = 0;
+//    satoko_stats(pSolver->pSat)->n_conflicts = 0;
     return RetValue;
 }
+int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+{
+    abctime clk = Abc_Clock();
+    int status = Cec3_ManSweepNodeSolve( p, iObj );
+    return Cec3_ManSweepNodeUpdate( p, p, iObj, status, Abc_Clock() - clk );
+}
+int Cec3_ManSweepNodeFinish( Cec3_Man_t * pMan, int i, int RetValue )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj = Gia_ManObj( p, i );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p, i );
+    if ( RetValue )
+    {
+        if ( Gia_ObjProved(p, i) )
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+        return 0;
+    }
+    pObj->Value = ~0;
+    Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), i, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Per-thread SAT solving managers.]
+
+  Description [Each worker has its own SAT solver and its own CNF cone
+  loader. The worker's AIG is a shallow copy of the internal AIG, which
+  shares the objects with it but keeps its own SAT variable map (vCopies2) 
+  and its own traversal IDs. It is refreshed before each batch, while the 
+  internal AIG is not being changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec3_Man_t * Cec3_ManCreateWorker( Cec3_Man_t * pMan )
+{
+    Cec3_Man_t * p  = ABC_CALLOC( Cec3_Man_t, 1 );
+    p->pPars        = pMan->pPars;
+    p->pAig         = pMan->pAig;
+    p->pNew         = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pSat         = bmcg_sat_solver_start();
+    p->vFrontier    = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vNodesNew    = Vec_IntAlloc( 100 );
+    p->vSatVars     = Vec_IntAlloc( 100 );
+    p->vObjSatPairs = Vec_IntAlloc( 100 );
+    return p;
+}
+void Cec3_ManSyncWorker( Cec3_Man_t * p, Gia_Man_t * pNew )
+{
+    Gia_Man_t * pShadow = p->pNew;
+    Vec_Int_t vCopies2  = pShadow->vCopies2;
+    int * pTravIds      = pShadow->pTravIds;
+    int nTravIds        = pShadow->nTravIds;
+    int nTravIdsAlloc   = pShadow->nTravIdsAlloc;
+    *pShadow = *pNew;
+    pShadow->vCopies2      = vCopies2;
+    pShadow->pTravIds      = pTravIds;
+    pShadow->nTravIds      = nTravIds;
+    pShadow->nTravIdsAlloc = nTravIdsAlloc;
+    Vec_IntFillExtra( &pShadow->vCopies2, Gia_ManObjNum(pNew), -1 );
+}
+void Cec3_ManDestroyWorker( Cec3_Man_t * p )
+{
+    Vec_IntErase( &p->pNew->vCopies2 );
+    ABC_FREE( p->pNew->pTravIds );
+    ABC_FREE( p->pNew );
+    bmcg_sat_solver_stop( p->pSat );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vNodesNew );
+    Vec_IntFreeP( &p->vSatVars );
+    Vec_IntFreeP( &p->vObjSatPairs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves a batch of candidate pairs concurrently.]
+
+  Description [The nodes in the batch are independent: none of them is
+  in the transitive fanin of another one. Each thread solves one node 
+  with its own solver. After all threads are done, the results are 
+  applied in the order of the nodes and the counter-examples are copied 
+  into the shared simulation info, which gives the same outcome as 
+  solving the nodes one by one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define CEC3_THR_MAX 100
+typedef struct Cec3_ThPool_t_
+{
+    int             nJobs;      // the number of nodes in the batch
+    int             iRound;     // the number of batches posted
+    int             nBusy;      // the number of threads still working
+    int             fStop;      // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;  // signals the threads about a new batch
+    pthread_cond_t  CondDone;   // signals the main thread about completion
+} Cec3_ThPool_t;
+typedef struct Cec3_ThData_t_
+{
+    pthread_t    Thread;
+    Cec3_ThPool_t * pPool;
+    Cec3_Man_t * p;
+    int          iThread;
+    int          iObj;
+    int          Result;
+    abctime      clkSolve;
+} Cec3_ThData_t;
+void * Cec3_WorkerThread( void * pArg )
+{
+    Cec3_ThData_t * pThData = (Cec3_ThData_t *)pArg;
+    Cec3_ThPool_t * pPool = pThData->pPool;
+    int iRound = 0, nJobs, fStop;
+    abctime clk;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        nJobs  = pPool->nJobs;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        if ( pThData->iThread >= nJobs )
+            continue;
+        clk = Abc_Clock();
+        pThData->Result   = Cec3_ManSweepNodeSolve( pThData->p, pThData->iObj );
+        pThData->clkSolve = Abc_Clock() - clk;
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+void Cec3_ManStartThreads( Cec3_Man_t * p )
+{
+    Cec3_ThData_t * pThData;
+    Cec3_ThPool_t * pPool = ABC_CALLOC( Cec3_ThPool_t, 1 );
+    int i, status, nThreads = Abc_MinInt( p->pPars->nThreads, CEC3_THR_MAX );
+    p->vWorkers = Vec_PtrAlloc( nThreads );
+    p->vBatch   = Vec_IntAlloc( nThreads );
+    p->pThData  = pThData = ABC_CALLOC( Cec3_ThData_t, nThreads );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Vec_PtrPush( p->vWorkers, Cec3_ManCreateWorker(p) );
+        pThData[i].pPool   = pPool;
+        pThData[i].p       = (Cec3_Man_t *)Vec_PtrEntry( p->vWorkers, i );
+        pThData[i].iThread = i;
+        pThData[i].iObj    = -1;
+        status = pthread_create( &pThData[i].Thread, NULL, Cec3_WorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+}
+void Cec3_ManStopThreads( Cec3_Man_t * p )
+{
+    Cec3_ThData_t * pThData = (Cec3_ThData_t *)p->pThData;
+    Cec3_ThPool_t * pPool;
+    Cec3_Man_t * pWorker; int i;
+    if ( p->vWorkers == NULL )
+        return;
+    pPool = pThData[0].pPool;
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    Vec_PtrForEachEntry( Cec3_Man_t *, p->vWorkers, pWorker, i )
+    {
+        pthread_join( pThData[i].Thread, NULL );
+        Cec3_ManDestroyWorker( pWorker );
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    ABC_FREE( pPool );
+    Vec_PtrFreeP( &p->vWorkers );
+    Vec_IntFreeP( &p->vBatch );
+    ABC_FREE( p->pThData );
+}
+int Cec3_ManSolveBatch( Cec3_Man_t * p )
+{
+    Cec3_ThData_t * pThData = (Cec3_ThData_t *)p->pThData;
+    Cec3_ThPool_t * pPool = pThData[0].pPool;
+    int i, iObj, RetValue, fDisproved = 0;
+    Vec_IntForEachEntry( p->vBatch, iObj, i )
+    {
+        Cec3_ManSyncWorker( pThData[i].p, p->pNew );
+        pThData[i].iObj = iObj;
+    }
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->nJobs = Vec_IntSize( p->vBatch );
+    pPool->nBusy = Vec_IntSize( p->vBatch );
+    pPool->iRound++;
+    pthread_cond_broadcast( &pPool->CondStart );
+    while ( pPool->nBusy > 0 )
+        pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+    pthread_mutex_unlock( &pPool->Mutex );
+    Vec_IntForEachEntry( p->vBatch, iObj, i )
+    {
+        RetValue = Cec3_ManSweepNodeUpdate( p, pThData[i].p, iObj, pThData[i].Result, pThData[i].clkSolve );
+        fDisproved |= Cec3_ManSweepNodeFinish( p, iObj, RetValue );
+    }
+    Vec_IntClear( p->vBatch );
+    return fDisproved;
+}
+
+#else // pthreads are not used
+
+void Cec3_ManStartThreads( Cec3_Man_t * p ) {}
+void Cec3_ManStopThreads( Cec3_Man_t * p )  {}
+int  Cec3_ManSolveBatch( Cec3_Man_t * p )   { return 0; }
+
+#endif // pthreads are used
+
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
     if ( !pPars->fVerbose )
@@ -950,6 +1190,8 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
     }
     // perform sweeping
     //pMan = Cec3_ManCreate( p, pPars );
+    if ( pPars->nThreads > 1 )
+        Cec3_ManStartThreads( pMan );
     for ( Iter = 0; fDisproved && Iter < pPars->nItersMax; Iter++ )
     {
         fDisproved = 0;
@@ -960,6 +1202,8 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         {
             if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
                 continue;
+            if ( pMan->vBatch && Vec_IntSize(pMan->vBatch) && (Vec_IntFind(pMan->vBatch, Gia_ObjFaninId0(pObj, i)) >= 0 || Vec_IntFind(pMan->vBatch, Gia_ObjFaninId1(pObj, i)) >= 0) )
+                fDisproved |= Cec3_ManSolveBatch( pMan ); // the fanins should be solved first
             if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
                 continue;
             assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
@@ -982,16 +1226,17 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 Gia_ObjSetProved( p, i );
                 continue;
             }
-            if ( Cec3_ManSweepNode(pMan, i) )
+            if ( pMan->vBatch == NULL )
             {
-                if ( Gia_ObjProved(p, i) )
-                    pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+                fDisproved |= Cec3_ManSweepNodeFinish( pMan, i, Cec3_ManSweepNode(pMan, i) );
                 continue;
             }
-            pObj->Value = ~0;
-            Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), i, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
-            fDisproved = 1;
+            Vec_IntPush( pMan->vBatch, i );
+            if ( Vec_IntSize(pMan->vBatch) == Vec_PtrSize(pMan->vWorkers) )
+                fDisproved |= Cec3_ManSolveBatch( pMan );
         }
+        if ( pMan->vBatch && Vec_IntSize(pMan->vBatch) )
+            fDisproved |= Cec3_ManSolveBatch( pMan );
         if ( fDisproved )
         {
             int Fails = Cec3_ManSimulate( p, pMan->vCexTriples, pMan );
@@ -1002,6 +1247,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         }
         Cec3_ManPrintStats( p, pPars, pMan );
     }
+    Cec3_ManStopThreads( pMan );
     // finish the AIG, if it is not finished
     if ( ppNew )
     {
@@ -1031,6 +1277,7 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nThreads   = pPars0->nThreads;
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -19,6 +19,21 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/cnf/cnf.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "sat/bsat/satShare.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -767,6 +782,253 @@ clk2 = Abc_Clock();
     Cec_ManSatStop( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs with a portfolio of cooperating solvers.]
+
+  Description [All solvers load the same CNF of the AIG and assume the 
+  output literal in turn. Odd-numbered threads run Glucose and the others
+  run Satoko with different restart and garbage collection settings.
+  Short learnt clauses with small LBD are exchanged through lock-free 
+  rings and imported at restarts. The first solver to decide an output 
+  stops the others. Proved outputs are added to all solvers as units.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Cec_ManSatSolveMt( Gia_Man_t * pAig, Cec_ParSat_t * pPars ) { Cec_ManSatSolve( NULL, pAig, pPars, NULL, NULL, NULL ); }
+
+#else // pthreads are used
+
+#define CEC_SAT_THR_MAX  16     // the largest number of solver threads
+#define CEC_SAT_SHR_SIZE  8     // the largest exchanged clause
+#define CEC_SAT_SHR_LBD   2     // the largest LBD of an exchanged clause
+
+typedef struct Cec_SatThPool_t_
+{
+    int               iLit;      // the literal to assume
+    int               iWinner;   // the first thread to decide the output
+    int               fSolved;   // tells the solvers to stop
+    int               iRound;    // the number of outputs posted
+    int               nBusy;     // the number of threads still working
+    int               fStop;     // the threads should quit
+    pthread_mutex_t   Mutex;
+    pthread_cond_t    CondStart; // signals the threads about a new output
+    pthread_cond_t    CondDone;  // signals the main thread about completion
+} Cec_SatThPool_t;
+
+typedef struct Cec_SatThData_t_
+{
+    Cec_SatThPool_t * pPool;     // the thread pool
+    satoko_t *        pSatoko;   // Satoko solver (or NULL)
+    bmcg_sat_solver * pGlucose;  // Glucose solver (or NULL)
+    int               nConfs;    // the conflict limit (0 means no limit)
+    int               iThread;   // the thread number
+    int               status;    // 1 = sat; -1 = unsat; 0 = undecided
+} Cec_SatThData_t;
+
+void * Cec_ManSatWorkerThread( void * pArg )
+{
+    Cec_SatThData_t * pThData = (Cec_SatThData_t *)pArg;
+    Cec_SatThPool_t * pPool = pThData->pPool;
+    int iRound = 0, iLit, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        iLit   = pPool->iLit;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        if ( pThData->pSatoko )
+            pThData->status = satoko_solve_assumptions_limit( pThData->pSatoko, &iLit, 1, pThData->nConfs );
+        else
+        {
+            bmcg_sat_solver_set_conflict_budget( pThData->pGlucose, pThData->nConfs );
+            pThData->status = bmcg_sat_solver_solve( pThData->pGlucose, &iLit, 1 );
+        }
+        pthread_mutex_lock( &pPool->Mutex );
+        // the first solver to decide the output stops the others
+        if ( pPool->iWinner == -1 && pThData->status != 0 )
+        {
+            pPool->iWinner = pThData->iThread;
+            pPool->fSolved = 1;
+        }
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+static inline int Cec_ManSatThAddClause( Cec_SatThData_t * pThData, int * pLits, int nLits )
+{
+    if ( pThData->pSatoko )
+        return satoko_add_clause( pThData->pSatoko, pLits, nLits );
+    return bmcg_sat_solver_addclause( pThData->pGlucose, pLits, nLits );
+}
+static inline int Cec_ManSatThVarValue( Cec_SatThData_t * pThData, int iVar )
+{
+    if ( pThData->pSatoko )
+        return satoko_read_cex_varvalue( pThData->pSatoko, iVar );
+    return bmcg_sat_solver_read_cex_varvalue( pThData->pGlucose, iVar );
+}
+void Cec_ManSatSolveMt( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
+{
+    pthread_t WorkerThread[CEC_SAT_THR_MAX];
+    Cec_SatThData_t ThData[CEC_SAT_THR_MAX];
+    Cec_SatThPool_t Pool, * pPool = &Pool;
+    int pWins[CEC_SAT_THR_MAX] = {0};
+    Sat_Share_t * pShare;
+    Cnf_Dat_t * pCnf;
+    Abc_Cex_t * pCex;
+    Gia_Obj_t * pObj;
+    satoko_opts_t opts;
+    abctime clk = Abc_Clock();
+    int nThreads = Abc_MinInt( pPars->nThreads, CEC_SAT_THR_MAX );
+    int i, k, c, Lit, iWinner, status;
+    int nUnsat = 0, nSat = 0, nUndec = 0;
+    Vec_PtrFreeP( &pAig->vSeqModelVec );
+    if ( pPars->fSaveCexes )
+        pAig->vSeqModelVec = Vec_PtrStart( Gia_ManCoNum(pAig) );
+    // the CNF variable of the i-th CO is i+1; the CI variables come last
+    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pAig, 8, 0, 0, 0, 0 );
+    pShare = Sat_ShareStart( nThreads, CEC_SAT_SHR_SIZE, CEC_SAT_SHR_LBD );
+    satoko_default_opts( &opts );
+    memset( pPool, 0, sizeof(Cec_SatThPool_t) );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Cec_SatThData_t) );
+        ThData[i].pPool   = pPool;
+        ThData[i].iThread = i;
+        ThData[i].nConfs  = pPars->nBTLimit;
+        if ( i & 1 )
+        {
+            ThData[i].pGlucose = bmcg_sat_solver_start();
+            bmcg_sat_solver_set_nvars( ThData[i].pGlucose, pCnf->nVars );
+            bmcg_sat_solver_set_stop( ThData[i].pGlucose, &pPool->fSolved );
+            bmcg_sat_solver_set_share( ThData[i].pGlucose, Sat_ShareClient(pShare, i), Sat_ShareExport, Sat_ShareImport );
+        }
+        else
+        {
+            // modify parameters to get different solvers
+            opts.f_rst = 0.8 - i * 0.05;
+            opts.b_rst = 1.4 - i * 0.05;
+            opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
+            ThData[i].pSatoko = satoko_create();
+            satoko_configure( ThData[i].pSatoko, &opts );
+            satoko_setnvars( ThData[i].pSatoko, pCnf->nVars );
+            satoko_set_stop( ThData[i].pSatoko, &pPool->fSolved );
+            satoko_set_share( ThData[i].pSatoko, Sat_ShareClient(pShare, i), Sat_ShareExport, Sat_ShareImport );
+        }
+        for ( c = 0; c < pCnf->nClauses; c++ )
+            if ( !Cec_ManSatThAddClause( ThData + i, pCnf->pClauses[c], pCnf->pClauses[c+1]-pCnf->pClauses[c] ) )
+                assert( 0 ); // the CNF of a circuit is satisfiable
+    }
+    // start the threads
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManSatWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+        {
+            pObj->fMark0 = 0;
+            pObj->fMark1 = 1;
+            if ( pPars->fSaveCexes )
+                Vec_PtrWriteEntry( pAig->vSeqModelVec, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            continue;
+        }
+        // run the solvers until the first one decides the output
+        Lit = Abc_Var2Lit( i+1, 0 );
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->iLit    = Lit;
+        pPool->iWinner = -1;
+        pPool->nBusy   = nThreads;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        iWinner = pPool->iWinner;
+        pPool->fSolved = 0;
+        pthread_mutex_unlock( &pPool->Mutex );
+        status = iWinner >= 0 ? ThData[iWinner].status : 0;
+        if ( iWinner >= 0 )
+            pWins[iWinner]++;
+        pObj->fMark0 = (status == 1);
+        pObj->fMark1 = (status == -1);
+        if ( status == 0 )
+        {
+            nUndec++;
+            continue;
+        }
+        if ( status == -1 )
+        {
+            // the output is constant 0 from now on
+            Lit = Abc_LitNot( Lit );
+            for ( k = 0; k < nThreads; k++ )
+                Cec_ManSatThAddClause( ThData + k, &Lit, 1 );
+            if ( pPars->fSaveCexes )
+                Vec_PtrWriteEntry( pAig->vSeqModelVec, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            nUnsat++;
+            continue;
+        }
+        nSat++;
+        if ( pPars->fSaveCexes )
+        {
+            pCex = Abc_CexAlloc( 0, Gia_ManCiNum(pAig), 1 );
+            pCex->iPo = i;
+            pCex->iFrame = 0;
+            for ( k = 0; k < Gia_ManCiNum(pAig); k++ )
+                if ( Cec_ManSatThVarValue( ThData + iWinner, pCnf->nVars - Gia_ManCiNum(pAig) + k ) )
+                    Abc_InfoSetBit( pCex->pData, k );
+            Vec_PtrWriteEntry( pAig->vSeqModelVec, i, pCex );
+        }
+        if ( pPars->fCheckMiter )
+            break;
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Threads = %d.  Unsat calls = %d.  Sat calls = %d.  Undef calls = %d.  ", nThreads, nUnsat, nSat, nUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        for ( i = 0; i < nThreads; i++ )
+            Abc_Print( 1, "Solver %2d (%s) decided %d outputs.\n", i, ThData[i].pSatoko ? "satoko " : "glucose", pWins[i] );
+        Sat_SharePrintStats( pShare );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( ThData[i].pSatoko )
+            satoko_destroy( ThData[i].pSatoko );
+        else
+            bmcg_sat_solver_stop( ThData[i].pGlucose );
+    }
+    Sat_ShareStop( pShare );
+    Cnf_DataFree( pCnf );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of solving for the POs of the AIG.]
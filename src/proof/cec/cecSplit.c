@@ -24,6 +24,7 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilNam.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -46,7 +47,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, char * pFileName, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -302,12 +303,15 @@ Abc_Cex_t * Cec_SplitDeriveModel( Gia_Man_t * p, Cnf_Dat_t * pCnf, sat_solver *
   SeeAlso     []
 
 ***********************************************************************/
-static inline Cnf_Dat_t * Cec_GiaDeriveGiaRemapped( Gia_Man_t * p )
+static inline Cnf_Dat_t * Cec_GiaDeriveGiaRemapped( Gia_Man_t * p, Cnf_Man_t * pMan )
 {
     Cnf_Dat_t * pCnf;
     Aig_Man_t * pAig = Gia_ManToAigSimple( p );
     pAig->nRegs = 0;
-    pCnf = Cnf_Derive( pAig, 0 );//Aig_ManCoNum(pAig) );
+    if ( pMan ) // private manager of a thread
+        pCnf = Cnf_DeriveWithMan( pMan, pAig, 0 );
+    else
+        pCnf = Cnf_Derive( pAig, 0 );//Aig_ManCoNum(pAig) );
     Aig_ManStop( pAig );
     return pCnf;
 }
@@ -327,7 +331,7 @@ static inline sat_solver * Cec_GiaDeriveSolver( Gia_Man_t * p, Cnf_Dat_t * pCnf,
     sat_solver_set_runtime_limit( pSat, nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
     return pSat;
 }
-static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int * pnVars, int * pnConfs )
+static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut, int * pnVars, int * pnConfs, int (*pFuncStop)(int) )
 {
     int status;
     sat_solver * pSat = Cec_GiaDeriveSolver( p, pCnf, nTimeOut );
@@ -337,6 +341,7 @@ static inline int Cnf_GiaSolveOne( Gia_Man_t * p, Cnf_Dat_t * pCnf, int nTimeOut
         *pnConfs = 0;
         return 1;
     }
+    sat_solver_set_stop_func( pSat, pFuncStop );
     status   = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
     *pnVars  = sat_solver_nvars( pSat );
     *pnConfs = sat_solver_nconflicts( pSat );
@@ -412,8 +417,8 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
     int nIter, status, RetValue = -1;
     double Progress = 0;
     // check the problem
-    pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+    pCnf = Cec_GiaDeriveGiaRemapped( p, NULL );
+    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs, NULL );
     Cnf_DataFree( pCnf );
     if ( fVerbose )
         Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
@@ -458,8 +463,8 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
         Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
         // solve the problem
-        pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+        pCnf = Cec_GiaDeriveGiaRemapped( pPart, NULL );
+        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs, NULL );
         Cnf_DataFree( pCnf );
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
@@ -485,8 +490,8 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
         Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 0) );
         Gia_ManStop( pLast );
         // solve the problem
-        pCnf = Cec_GiaDeriveGiaRemapped( pPart );
-        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs );
+        pCnf = Cec_GiaDeriveGiaRemapped( pPart, NULL );
+        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nSatVars, &nSatConfs, NULL );
         Cnf_DataFree( pCnf );
         if ( status == 1 )
             Progress += 1.0 / pow((double)2, (double)Depth);
@@ -528,200 +533,414 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Cube-and-conquer manager.]
 
-  Description []
+  Description [A cube is a cofactor of the problem together with the
+  assignment leading to it (vCofVars). The pending cubes are kept in one
+  pool shared by all threads. An idle thread takes the last cube, solves
+  it under the runtime limit and, when it is not decided, splits it using
+  the look-ahead heuristic and returns the children to the pool. The more
+  threads are idle, the deeper the split. The outcome of each cube and
+  each split is appended to the log, which lets an interrupted run resume
+  without solving the proved cubes again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define PAR_THR_MAX   100
+#define PAR_SPLIT_MAX   4   // the largest number of splits applied to a cube at once
+#define PAR_LINE_MAX  (1 << 20)
+
+typedef struct Par_SplitMan_t_ Par_SplitMan_t;
+struct Par_SplitMan_t_
+{
+    Gia_Man_t *      p;             // the problem (one output)
+    int              iPo;           // the output index used in the log
+    int              nProcs;        // the number of threads
+    int              nTimeOut;      // the runtime limit per cube
+    int              nIterMax;      // the limit on the number of splits
+    int              LookAhead;     // the look-ahead during cofactoring
+    int              fVerbose;
+    int              fVeryVerbose;
+    FILE *           pFile;         // the cube log
+    Abc_Nam_t *      pNam;          // the cubes recorded in the log being resumed
+    Vec_Int_t *      vDone;         // their status (-1 = UNSAT; -2 = SAT; 1 + var = split)
+    Vec_Ptr_t *      vStack;        // the pending cubes
+    int              nBusy;         // the number of threads solving cubes
+    int              nCubes;        // the number of solved cubes
+    int              nResumed;      // the number of cubes proved in the resumed log
+    int              nIter;         // the number of splits
+    int              RetValue;      // the result
+    double           Progress;      // the fraction of the space proved UNSAT
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+};
+
+// set when a CEX is found or the limit on splits is reached
+static volatile int Par_SplitStop = 0;
+static int Par_SplitStopFunc( int RunId ) { return Par_SplitStop; }
+
+/**Function*************************************************************
+
+  Synopsis    [Reading and writing the cube log.]
+
+  Description [The log starts with the line "design <pi> <po> <and> <hash>"
+  identifying the miter by its size and structural hash. Each following
+  line is "<status> <output>: <cube>" with the status being "unsat", "sat"
+  or "split". The cube lists the cofactored inputs in the order of
+  splitting, as "+i" or "-i" for the i-th primary input set to 1 or 0.
+  Split lines end with "@ <i>" giving the splitting input. A log written
+  for a different miter is not resumed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Par_SplitManHash( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    unsigned Hash;
+    int i;
+    Hash = (unsigned)(Gia_ManCiNum(p) * 7937 + Gia_ManCoNum(p) * 2971 + Gia_ManRegNum(p) * 911 + Gia_ManAndNum(p));
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        Hash = Hash * 0x9E3779B1 + (unsigned)Abc_Var2Lit( Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj) );
+        if ( Gia_ObjIsAnd(pObj) )
+            Hash = Hash * 0x9E3779B1 + (unsigned)Abc_Var2Lit( Gia_ObjFaninId1(pObj, i), Gia_ObjFaninC1(pObj) );
+    }
+    return Hash;
+}
+static void Par_SplitWriteHeader( Gia_Man_t * p, FILE * pFile )
+{
+    fprintf( pFile, "# Cube log of &splitprove: <status> <output>: <cube> [@ <splitting input>]\n" );
+    fprintf( pFile, "design %d %d %d %u\n", Gia_ManPiNum(p), Gia_ManPoNum(p), Gia_ManAndNum(p), Par_SplitManHash(p) );
+}
+static char * Par_SplitCubeKey( Par_SplitMan_t * p, Gia_Man_t * pCube, Vec_Str_t * vStr )
+{
+    int i, iLit;
+    Vec_StrClear( vStr );
+    Vec_StrPrintNum( vStr, p->iPo );
+    Vec_StrPush( vStr, ':' );
+    if ( pCube->vCofVars )
+        Vec_IntForEachEntry( pCube->vCofVars, iLit, i )
+        {
+            Vec_StrPush( vStr, ' ' );
+            Vec_StrPush( vStr, (char)(Abc_LitIsCompl(iLit) ? '-' : '+') );
+            Vec_StrPrintNum( vStr, Abc_Lit2Var(iLit) );
+        }
+    Vec_StrPush( vStr, '\0' );
+    return Vec_StrArray( vStr );
+}
+static int Par_SplitCubeLookup( Par_SplitMan_t * p, char * pKey )
+{
+    // called by the threads without locking, so the array is not resized
+    int Id = p->pNam ? Abc_NamStrFind( p->pNam, pKey ) : 0;
+    return Id > 0 && Id < Vec_IntSize(p->vDone) ? Vec_IntEntry( p->vDone, Id ) : 0;
+}
+static void Par_SplitCubeLog( Par_SplitMan_t * p, char * pStatus, char * pKey, int iVar )
+{
+    if ( p->pFile == NULL )
+        return;
+    if ( iVar >= 0 )
+        fprintf( p->pFile, "%s %s @ %d\n", pStatus, pKey, iVar );
+    else
+        fprintf( p->pFile, "%s %s\n", pStatus, pKey );
+    fflush( p->pFile );
+}
+int Par_SplitReadLog( Gia_Man_t * p, char * pFileName, Abc_Nam_t ** ppNam, Vec_Int_t ** pvDone )
+{
+    FILE * pFile = fopen( pFileName, "rb" );
+    char * pBuffer, * pKey, * pStop;
+    int Value, Id, fFound, fHeader = 0, nLines = 0, nLinesAll = 0;
+    int nPis, nPos, nAnds;
+    unsigned Hash;
+    *ppNam  = NULL;
+    *pvDone = NULL;
+    if ( pFile == NULL )
+        return 0;
+    *ppNam  = Abc_NamStart( 1000, 24 );
+    *pvDone = Vec_IntAlloc( 1000 );
+    pBuffer = ABC_ALLOC( char, PAR_LINE_MAX );
+    while ( fgets( pBuffer, PAR_LINE_MAX, pFile ) )
+    {
+        nLinesAll++;
+        if ( !strncmp(pBuffer, "design ", 7) )
+        {
+            fHeader = 0;
+            if ( sscanf( pBuffer + 7, "%d %d %d %u", &nPis, &nPos, &nAnds, &Hash ) != 4 ||
+                 nPis != Gia_ManPiNum(p) || nPos != Gia_ManPoNum(p) || nAnds != Gia_ManAndNum(p) || Hash != Par_SplitManHash(p) )
+                break;
+            fHeader = 1;
+            continue;
+        }
+        if ( !fHeader )
+            continue;
+        if ( !strncmp(pBuffer, "unsat ", 6) )
+            Value = -1, pKey = pBuffer + 6;
+        else if ( !strncmp(pBuffer, "sat ", 4) )
+            Value = -2, pKey = pBuffer + 4;
+        else if ( !strncmp(pBuffer, "split ", 6) )
+            Value = 0, pKey = pBuffer + 6;
+        else
+            continue;
+        pStop = strchr( pKey, '@' );
+        if ( Value == 0 )
+        {
+            if ( pStop == NULL )
+                continue;
+            Value = 1 + atoi( pStop + 1 );
+        }
+        else if ( pStop == NULL )
+            pStop = pKey + strlen(pKey);
+        while ( pStop > pKey && (pStop[-1] == ' ' || pStop[-1] == '\n' || pStop[-1] == '\r') )
+            pStop--;
+        *pStop = 0;
+        Id = Abc_NamStrFindOrAdd( *ppNam, pKey, &fFound );
+        // a proved cube stays proved
+        if ( Vec_IntGetEntry(*pvDone, Id) != -1 )
+            Vec_IntSetEntry( *pvDone, Id, Value );
+        nLines++;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    // the log cannot be resumed if it was written for a different miter
+    if ( !fHeader && nLinesAll > 0 )
+    {
+        Abc_NamStop( *ppNam );
+        Vec_IntFree( *pvDone );
+        *ppNam  = NULL;
+        *pvDone = NULL;
+        return -1;
+    }
+    return nLines;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the cube and adds the resulting cubes to the pool.]
+
+  Description [Applies nSplits levels of splitting using the look-ahead
+  heuristic. Cubes recorded in the resumed log are split on the same
+  variable as before, while the cubes proved there are dropped. Takes
+  ownership of the cube.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
-typedef struct Par_ThData_t_
+static void Par_SplitCube( Par_SplitMan_t * p, Gia_Man_t * pCube, int nSplits, Vec_Str_t * vStr )
 {
-    Gia_Man_t * p;
+    Gia_Man_t * pPart;
+    int Depth = pCube->vCofVars ? Vec_IntSize(pCube->vCofVars) : 0;
+    int k, iVar, nFanouts, Cost, Value = Par_SplitCubeLookup( p, Par_SplitCubeKey(p, pCube, vStr) );
+    if ( Value == -1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->Progress += 1.0 / pow((double)2, (double)Depth);
+        p->nResumed++;
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_ManStop( pCube );
+        return;
+    }
+    if ( Value <= 0 && (nSplits == 0 || Gia_ManAndNum(pCube) == 0) )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        Vec_PtrPush( p->vStack, pCube );
+        pthread_cond_signal( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        return;
+    }
+    if ( Value > 0 )
+        iVar = Value - 1, nSplits = 1;
+    else
+    {
+        iVar = Gia_SplitCofVar( pCube, p->LookAhead, &nFanouts, &Cost );
+        pthread_mutex_lock( &p->Mutex );
+        Par_SplitCubeLog( p, "split", Vec_StrArray(vStr), iVar );
+        if ( p->fVeryVerbose )
+            printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.\n", iVar, nFanouts, Cost, Gia_ManAndNum(pCube) );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    for ( k = 0; k < 2; k++ )
+    {
+        pPart = Gia_ManDupCofactorVar( pCube, iVar, k );
+        pPart->vCofVars = Vec_IntAlloc( Depth + 1 );
+        if ( pCube->vCofVars )
+            Vec_IntAppend( pPart->vCofVars, pCube->vCofVars );
+        Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, !k) );
+        Par_SplitCube( p, pPart, nSplits - 1, vStr );
+    }
+    Gia_ManStop( pCube );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one cube.]
+
+  Description [Takes ownership of the cube.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Par_SplitSolve( Par_SplitMan_t * p, Gia_Man_t * pCube, Cnf_Man_t * pCnfMan, Vec_Str_t * vStr )
+{
+    abctime clk = Abc_Clock();
     Cnf_Dat_t * pCnf;
-    int         iThread;
-    int         nTimeOut;
-    int         fWorking;
-    int         Result;
-    int         nVars;
-    int         nConfs;
-} Par_ThData_t;
+    int Depth = pCube->vCofVars ? Vec_IntSize(pCube->vCofVars) : 0;
+    int status, nWanted, nSplits = 0, nVars = 0, nConfs = 0;
+    int Value = Par_SplitCubeLookup( p, Par_SplitCubeKey(p, pCube, vStr) );
+    if ( Value == -1 || Value > 0 )
+    {
+        // replay the resumed log
+        Par_SplitCube( p, pCube, 0, vStr );
+        return;
+    }
+    pCnf   = Cec_GiaDeriveGiaRemapped( pCube, pCnfMan );
+    status = Cnf_GiaSolveOne( pCube, pCnf, p->nTimeOut, &nVars, &nConfs, Par_SplitStopFunc );
+    Cnf_DataFree( pCnf );
+    pthread_mutex_lock( &p->Mutex );
+    if ( status == -1 && Par_SplitStop )
+    {
+        // interrupted because the run is over
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_ManStop( pCube );
+        return;
+    }
+    p->nCubes++;
+    if ( status == 1 )
+        p->Progress += 1.0 / pow((double)2, (double)Depth);
+    if ( status != -1 )
+        Par_SplitCubeLog( p, status ? "unsat" : "sat", Vec_StrArray(vStr), -1 );
+    if ( p->fVerbose )
+    {
+        Cec_GiaSplitPrint( p->nCubes, Depth, nVars, nConfs, status, p->Progress, Abc_Clock() - clk );
+        if ( p->fVeryVerbose )
+            printf( "Cube %s\n", Vec_StrArray(vStr) );
+    }
+    if ( status == 0 && p->RetValue == -1 )
+    {
+        p->p->pCexComb = pCube->pCexComb;  pCube->pCexComb = NULL;
+        p->RetValue = 0;
+        Par_SplitStop = 1;
+    }
+    if ( status == -1 )
+    {
+        // split deeper when there are idle threads without cubes
+        nWanted = p->nProcs - p->nBusy - Vec_PtrSize(p->vStack) + 1;
+        nSplits = Abc_MinInt( Abc_MaxInt(1, Abc_Base2Log(nWanted)), PAR_SPLIT_MAX );
+        if ( p->nIterMax && ++p->nIter > p->nIterMax )
+            Par_SplitStop = 1, nSplits = 0;
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    if ( nSplits )
+        Par_SplitCube( p, pCube, nSplits, vStr );
+    else
+        Gia_ManStop( pCube );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes cubes from the pool until all of them are solved.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void * Cec_GiaSplitWorkerThread( void * pArg )
 {
-    Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
+    Par_SplitMan_t * p = (Par_SplitMan_t *)pArg;
+    Cnf_Man_t * pCnfMan = Cnf_ManStart();
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    Gia_Man_t * pCube;
     while ( 1 )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
+        pthread_mutex_lock( &p->Mutex );
+        while ( !Par_SplitStop && Vec_PtrSize(p->vStack) == 0 && p->nBusy > 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( Par_SplitStop || Vec_PtrSize(p->vStack) == 0 )
         {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            pthread_cond_broadcast( &p->Cond );
+            pthread_mutex_unlock( &p->Mutex );
+            break;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
+        pCube = (Gia_Man_t *)Vec_PtrPop( p->vStack );
+        p->nBusy++;
+        pthread_mutex_unlock( &p->Mutex );
+        Par_SplitSolve( p, pCube, pCnfMan, vStr );
+        pthread_mutex_lock( &p->Mutex );
+        p->nBusy--;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
     }
-    assert( 0 );
+    Vec_StrFree( vStr );
+    Cnf_ManStop( pCnfMan );
     return NULL;
 }
-int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+int Cec_GiaSplitTestInt( Gia_Man_t * p, int iPo, int nProcs, int nTimeOut, int nIterMax, int LookAhead, FILE * pFile, Abc_Nam_t * pNam, Vec_Int_t * vDone, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack;
-    Cnf_Dat_t * pCnf;
-    double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    Par_SplitMan_t Man, * pMan = &Man;
+    Vec_Str_t * vStr;
+    int i, status, RetValue;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
     if ( fVerbose )
         printf( "Processes = %d   TimeOut = %d sec   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nIterMax, LookAhead, fVerbose );
     fflush( stdout );
-    if ( nProcs == 1 )
+    if ( nProcs == 1 && pFile == NULL && pNam == NULL )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
     assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
-    // check the problem
-    pCnf = Cec_GiaDeriveGiaRemapped( p );
-    status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
-    Cnf_DataFree( pCnf );
-    if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
-    if ( status == 0 )
+    memset( pMan, 0, sizeof(Par_SplitMan_t) );
+    pMan->p            = p;
+    pMan->iPo          = iPo;
+    pMan->nProcs       = nProcs;
+    pMan->nTimeOut     = nTimeOut;
+    pMan->nIterMax     = nIterMax;
+    pMan->LookAhead    = LookAhead;
+    pMan->fVerbose     = fVerbose;
+    pMan->fVeryVerbose = fVeryVerbose;
+    pMan->pFile        = pFile;
+    pMan->pNam         = pNam;
+    pMan->vDone        = vDone;
+    pMan->vStack       = Vec_PtrAlloc( 1000 );
+    pMan->RetValue     = -1;
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    pthread_cond_init( &pMan->Cond, NULL );
+    Par_SplitStop = 0;
+    // the look-ahead cuber produces at least one cube per thread
+    vStr = Vec_StrAlloc( 1000 );
+    Par_SplitCube( pMan, Gia_ManDup(p), Abc_Base2Log(nProcs), vStr );
+    Vec_StrFree( vStr );
+    // start the threads; the calling thread is one of them
+    for ( i = 1; i < nProcs; i++ )
     {
-        if ( !fSilent )
-        printf( "The problem is SAT without cofactoring.\n" );
-        return 0;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaSplitWorkerThread, (void *)pMan );  assert( status == 0 );
     }
-    if ( status == 1 )
+    Cec_GiaSplitWorkerThread( pMan );
+    for ( i = 1; i < nProcs; i++ )
     {
-        if ( !fSilent )
-        printf( "The problem is UNSAT without cofactoring.\n" );
-        return 1;
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
     }
-    assert( status == -1 );
-    // create local copy
-    vStack = Vec_PtrAlloc( 1000 );
-    Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].p        = NULL;
-        ThData[i].pCnf     = NULL;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        ThData[i].nVars    = -1;
-        ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-    // look at the threads
-    while ( fWorkToDo )
-    {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
-        {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
-            {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow((double)2, (double)Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
-        }
-        if ( nIterMax && nIter >= nIterMax )
-            break;
-    }
-    if ( !fWorkToDo )
+    // the pool is exhausted unless the run was stopped
+    RetValue = pMan->RetValue;
+    if ( RetValue == -1 && !Par_SplitStop )
         RetValue = 1;
-finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        // cleanup
-        Gia_ManStopP( &ThData[i].p );
-        if ( ThData[i].pCnf == NULL )
-            continue;
-        Cnf_DataFree( ThData[i].pCnf );
-        ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
-    }
-    // finish
-    Cec_GiaSplitClean( vStack );
+    Cec_GiaSplitClean( pMan->vStack );
+    pthread_mutex_destroy( &pMan->Mutex );
+    pthread_cond_destroy( &pMan->Cond );
     if ( !fSilent )
     {
         if ( RetValue == 0 )
@@ -731,36 +950,93 @@ finish:
         else if ( RetValue == -1 )
             printf( "Problem is UNDECIDED " );
         else assert( 0 );
-        printf( "after %d case-splits.  ", nIter );
+        printf( "after %d cubes", pMan->nCubes );
+        if ( pMan->nResumed )
+            printf( " (and %d cubes proved before)", pMan->nResumed );
+        printf( ".  " );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
         fflush( stdout );
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+
+/**Function*************************************************************
+
+  Synopsis    [Translates the CEX of one output cone to the whole miter.]
+
+  Description [Assumes that the object values of the miter point to the
+  cone produced by Gia_ManDupOutputGroup().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Cec_GiaSplitRemapCex( Gia_Man_t * p, Gia_Man_t * pOne, Abc_Cex_t * pCexOne, int iPo )
+{
+    Abc_Cex_t * pCex = Abc_CexAlloc( 0, Gia_ManPiNum(p), 1 );
+    Gia_Obj_t * pObj, * pObjOne;
+    int i;
+    pCex->iPo    = iPo;
+    pCex->iFrame = 0;
+    Gia_ManForEachPi( p, pObj, i )
+    {
+        if ( !~pObj->Value )
+            continue;
+        pObjOne = Gia_ManObj( pOne, Abc_Lit2Var(pObj->Value) );
+        assert( Gia_ObjIsPi(pOne, pObjOne) );
+        if ( Abc_InfoHasBit(pCexOne->pData, Gia_ObjCioId(pObjOne)) )
+            Abc_InfoSetBit( pCex->pData, i );
+    }
+    return pCex;
+}
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, char * pFileName, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
+    Abc_Nam_t * pNam = NULL;
+    Vec_Int_t * vDone = NULL;
+    FILE * pFile = NULL;
     Gia_Man_t * pOne;
     Gia_Obj_t * pObj;
     int i, RetValue1, fOneUndef = 0, RetValue = -1;
     Abc_CexFreeP( &p->pCexComb );
+    if ( pFileName )
+    {
+        int nLines = Par_SplitReadLog( p, pFileName, &pNam, &vDone );
+        if ( nLines == -1 )
+        {
+            printf( "The cube log \"%s\" was written for a different miter.\n", pFileName );
+            return -1;
+        }
+        if ( nLines && !fSilent )
+            printf( "Resuming from %d records in the cube log \"%s\".\n", nLines, pFileName );
+        pFile = fopen( pFileName, "ab" );
+        if ( pFile == NULL )
+            printf( "Cannot open file \"%s\" for writing the cube log.\n", pFileName );
+        else if ( ftell(pFile) == 0 )
+            Par_SplitWriteHeader( p, pFile );
+    }
     Gia_ManForEachPo( p, pObj, i )
     {
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        RetValue1 = Cec_GiaSplitTestInt( pOne, i, nProcs, nTimeOut, nIterMax, LookAhead, pFile, pNam, vDone, fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
-            pCex = pOne->pCexComb; pOne->pCexComb = NULL;
-            pCex->iPo = i;
+            pCex = Cec_GiaSplitRemapCex( p, pOne, pOne->pCexComb, i );
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
+    if ( pFile )
+        fclose( pFile );
+    if ( pNam )
+        Abc_NamStop( pNam );
+    Vec_IntFreeP( &vDone );
     if ( RetValue == -1 )
         RetValue = fOneUndef ? -1 : 1;
     else
@@ -58,6 +58,7 @@ struct Dch_Pars_t_
     abctime          timeSynth;     // synthesis runtime
     int              nNodesAhead;   // the lookahead in terms of nodes
     int              nCallsRecycle; // calls to perform before recycling SAT solver
+    int              nThreads;      // the number of threads for SAT checks (0 = no batching)
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -57,6 +57,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->fVerbose       =     0;  // verbose stats
     p->nNodesAhead    =  1000;  // the lookahead in terms of nodes
     p->nCallsRecycle  =   100;  // calls to perform before recycling SAT solver
+    p->nThreads       =     0;  // the number of threads for SAT checks (0 = no batching)
 }
 
 /**Function*************************************************************
@@ -102,7 +103,10 @@ p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
     // perform SAT sweeping
-    Dch_ManSweep( p );
+    if ( pPars->nThreads > 0 )
+        Dch_ManSweepMt( p );
+    else
+        Dch_ManSweep( p );
     // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop( p );
@@ -146,7 +150,10 @@ p->timeSimInit = Abc_Clock() - clk;
 //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum( p->ppClasses );
     // perform SAT sweeping
-    Dch_ManSweep( p );
+    if ( pPars->nThreads > 0 )
+        Dch_ManSweepMt( p );
+    else
+        Dch_ManSweep( p );
     // free memory ahead of time
 p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop( p );
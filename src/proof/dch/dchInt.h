@@ -69,6 +69,7 @@ struct Dch_Man_t_
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
     Vec_Ptr_t *      vSimRoots;      // the roots of cand const 1 nodes to simulate
     Vec_Ptr_t *      vSimClasses;    // the roots of cand equiv classes to simulate
+    int *            pCexVals;       // the values of fraiged CIs in the counter-example of another solver
     // solver cone size
     int              nConeThis;
     int              nConeMax;
@@ -155,6 +156,7 @@ extern void          Dch_ManResimulateCex( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_
 extern void          Dch_ManResimulateCex2( Dch_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pRepr );
 /*=== dchSweep.c ===================================================*/
 extern void          Dch_ManSweep( Dch_Man_t * p );
+extern void          Dch_ManSweepMt( Dch_Man_t * p );
 
 
 
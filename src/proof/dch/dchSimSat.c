@@ -119,6 +119,12 @@ void Dch_ManResimulateSolved_rec( Dch_Man_t * p, Aig_Obj_t * pObj )
         int nVarNum;
         pObjFraig = Dch_ObjFraig( pObj );
         assert( !Aig_IsComplement(pObjFraig) );
+        // get the value from the counter-example found by another solver
+        if ( p->pCexVals )
+        {
+            pObj->fMarkB = p->pCexVals[Aig_ObjId(pObjFraig)];
+            return;
+        }
         nVarNum = Dch_ObjSatNum( p, pObjFraig );
         // get the value from the SAT solver
         // (account for the fact that some vars may be minimized away)
@@ -21,6 +21,16 @@
 #include "dchInt.h"
 #include "misc/bar/bar.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -137,6 +147,354 @@ void Dch_ManSweep( Dch_Man_t * p )
     Aig_ManCleanMarkB( p->pAigTotal );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs fraiging for the internal nodes using several solvers.]
+
+  Description [The SAT checks are collected into batches while the fraiged 
+  AIG is constructed. A node whose fanin is checked in the current batch 
+  is delayed until the next batch, so the fraiged AIG is built as in the 
+  sequential sweep, and at most nNodesAhead new nodes are scanned for one 
+  batch. The checks of a batch are solved by a fixed number of solver 
+  contexts, each with its own incremental SAT solver, and the contexts 
+  are distributed among the threads. The check with index k in the batch 
+  is always solved by context (k % DCH_CTX_NUM), in the order of checks, 
+  and the results are applied by this thread in the order of checks, so 
+  the choices do not depend on the number of threads. A disproved check 
+  whose class was already refined by an earlier counter-example of the 
+  batch is skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define DCH_CTX_NUM     8    // the number of solver contexts
+#define DCH_CTX_JOBS   16    // the number of checks of one context in a batch
+
+typedef struct Dch_Job_t_ Dch_Job_t;
+struct Dch_Job_t_
+{
+    Aig_Obj_t *      pObj;           // the node
+    Aig_Obj_t *      pRepr;          // its representative
+    int              RetValue;       // the result of the check
+    Vec_Int_t *      vCex;           // the values of fraiged CIs in the counter-example
+};
+static Dch_Man_t * Dch_ManCtxStart( Dch_Man_t * p )
+{
+    Dch_Man_t * pCtx = ABC_CALLOC( Dch_Man_t, 1 );
+    pCtx->pPars      = p->pPars;
+    pCtx->pAigTotal  = p->pAigTotal;
+    pCtx->pAigFraig  = p->pAigFraig;
+    pCtx->nSatVars   = 1;
+    pCtx->pSatVars   = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    pCtx->vUsedNodes = Vec_PtrAlloc( 1000 );
+    pCtx->vFanins    = Vec_PtrAlloc( 100 );
+    return pCtx;
+}
+static void Dch_ManCtxStop( Dch_Man_t * p, Dch_Man_t * pCtx )
+{
+    p->nSatVars       += pCtx->nSatVars;
+    p->nRecycles      += pCtx->nRecycles;
+    p->nSatCalls      += pCtx->nSatCalls;
+    p->nSatProof      += pCtx->nSatProof;
+    p->nSatFailsReal  += pCtx->nSatFailsReal;
+    p->nSatCallsUnsat += pCtx->nSatCallsUnsat;
+    p->nSatCallsSat   += pCtx->nSatCallsSat;
+    p->timeSat        += pCtx->timeSat;
+    p->timeSatSat     += pCtx->timeSatSat;
+    p->timeSatUnsat   += pCtx->timeSatUnsat;
+    p->timeSatUndec   += pCtx->timeSatUndec;
+    if ( pCtx->pSat )
+        sat_solver_delete( pCtx->pSat );
+    Vec_PtrFree( pCtx->vUsedNodes );
+    Vec_PtrFree( pCtx->vFanins );
+    ABC_FREE( pCtx->pSatVars );
+    ABC_FREE( pCtx );
+}
+static void Dch_ManCtxSolve( Dch_Man_t * pCtx, Dch_Job_t * pJob )
+{
+    Aig_Obj_t * pNode;
+    int i;
+    pJob->RetValue = Dch_NodesAreEquiv( pCtx, Aig_Regular(Dch_ObjFraig(pJob->pRepr)), Aig_Regular(Dch_ObjFraig(pJob->pObj)) );
+    if ( pJob->RetValue != 0 )
+        return;
+    // save the counter-example before the solver is used again
+    Vec_IntClear( pJob->vCex );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pCtx->vUsedNodes, pNode, i )
+        if ( Aig_ObjIsCi(pNode) )
+            Vec_IntPush( pJob->vCex, Abc_Var2Lit(Aig_ObjId(pNode), sat_solver_var_value(pCtx->pSat, Dch_ObjSatNum(pCtx, pNode))) );
+}
+static void Dch_ManCtxSolveBatch( Dch_Man_t ** pCtxs, Dch_Job_t * pJobs, int nJobs, int iThread, int nThreads )
+{
+    int c, k;
+    for ( c = iThread; c < DCH_CTX_NUM; c += nThreads )
+        for ( k = c; k < nJobs; k += DCH_CTX_NUM )
+            Dch_ManCtxSolve( pCtxs[c], pJobs + k );
+}
+
+typedef struct Dch_ThPool_t_
+{
+    Dch_Man_t **     pCtxs;
+    Dch_Job_t *      pJobs;
+    int              nJobs;       // the number of checks in the batch
+    int              nThreads;    // the number of threads
+    int              iRound;      // the number of batches posted
+    int              nBusy;       // the number of threads still working
+    int              fStop;       // the threads should quit
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   CondStart;   // signals the threads about a new batch
+    pthread_cond_t   CondDone;    // signals the main thread about completion
+#endif
+} Dch_ThPool_t;
+
+typedef struct Dch_ThData_t_
+{
+    Dch_ThPool_t *   pPool;
+    int              iThread;
+} Dch_ThData_t;
+
+#ifdef ABC_USE_PTHREADS
+
+void * Dch_WorkerThread( void * pArg )
+{
+    Dch_ThData_t * pThData = (Dch_ThData_t *)pArg;
+    Dch_ThPool_t * pPool = pThData->pPool;
+    int iRound = 0, nJobs, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->iRound == iRound && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        iRound = pPool->iRound;
+        nJobs  = pPool->nJobs;
+        fStop  = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        Dch_ManCtxSolveBatch( pPool->pCtxs, pPool->pJobs, nJobs, pThData->iThread, pPool->nThreads );
+        pthread_mutex_lock( &pPool->Mutex );
+        if ( --pPool->nBusy == 0 )
+            pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+static void Dch_ManApplyJob( Dch_Man_t * p, Dch_Job_t * pJob )
+{
+    Aig_Obj_t * pObj = pJob->pObj, * pRepr = pJob->pRepr;
+    int i, Lit;
+    if ( pJob->RetValue == -1 ) // timed out
+    {
+        Dch_ObjSetFraig( pObj, NULL );
+        return;
+    }
+    if ( pJob->RetValue == 1 )  // proved equivalent
+    {
+        Dch_ObjSetFraig( pObj, Aig_NotCond( Aig_Regular(Dch_ObjFraig(pRepr)), pObj->fPhase ^ pRepr->fPhase ) );
+        p->pReprsProved[ pObj->Id ] = pRepr;
+        return;
+    }
+    // the class was refined by an earlier counter-example
+    if ( Aig_ObjRepr( p->pAigTotal, pObj ) != pRepr )
+        return;
+    // disproved the equivalence
+    Vec_IntForEachEntry( pJob->vCex, Lit, i )
+        p->pCexVals[Abc_Lit2Var(Lit)] = Abc_LitIsCompl(Lit);
+    if ( p->pPars->fSimulateTfo )
+        Dch_ManResimulateCex( p, pObj, pRepr );
+    else
+        Dch_ManResimulateCex2( p, pObj, pRepr );
+    assert( Aig_ObjRepr( p->pAigTotal, pObj ) != pRepr );
+    Vec_IntForEachEntry( pJob->vCex, Lit, i )
+        p->pCexVals[Abc_Lit2Var(Lit)] = 0;
+}
+static void Dch_ManRunBatch( Dch_Man_t * p, Dch_ThPool_t * pPool, int nJobs )
+{
+    int k;
+#ifdef ABC_USE_PTHREADS
+    if ( pPool->nThreads > 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        pPool->nJobs = nJobs;
+        pPool->nBusy = pPool->nThreads - 1;
+        pPool->iRound++;
+        pthread_cond_broadcast( &pPool->CondStart );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+#endif
+    Dch_ManCtxSolveBatch( pPool->pCtxs, pPool->pJobs, nJobs, 0, pPool->nThreads );
+#ifdef ABC_USE_PTHREADS
+    if ( pPool->nThreads > 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->nBusy > 0 )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+#endif
+    // apply the results in the order of checks
+    for ( k = 0; k < nJobs; k++ )
+        Dch_ManApplyJob( p, pPool->pJobs + k );
+}
+static int Dch_ManAddNode( Dch_Man_t * p, Aig_Obj_t * pObj, int * pBatches, int iBatch, Dch_Job_t * pJob )
+{
+    Aig_Obj_t * pObjNew, * pObjRepr, * pObjFraig, * pObjReprFraig;
+    // the fraiged fanins should not depend on the checks in progress
+    if ( pBatches[Aig_ObjFaninId0(pObj)] == iBatch || pBatches[Aig_ObjFaninId1(pObj)] == iBatch )
+    {
+        pBatches[pObj->Id] = iBatch;
+        return -1;
+    }
+    if ( Dch_ObjFraig(Aig_ObjFanin0(pObj)) == NULL || 
+         Dch_ObjFraig(Aig_ObjFanin1(pObj)) == NULL )
+        return 0;
+    pObjNew = Aig_And( p->pAigFraig, Dch_ObjChild0Fra(pObj), Dch_ObjChild1Fra(pObj) );
+    if ( pObjNew == NULL )
+        return 0;
+    Dch_ObjSetFraig( pObj, pObjNew );
+    // check if the node needs a SAT check
+    pObjRepr = Aig_ObjRepr( p->pAigTotal, pObj );
+    if ( pObjRepr == NULL )
+        return 0;
+    pObjFraig = Dch_ObjFraig( pObj );
+    pObjReprFraig = Dch_ObjFraig( pObjRepr );
+    if ( pObjReprFraig == NULL )
+        return 0;
+    if ( Aig_Regular(pObjFraig) == Aig_Regular(pObjReprFraig) )
+    {
+        p->pReprsProved[ pObj->Id ] = pObjRepr;
+        return 0;
+    }
+    assert( Aig_Regular(pObjFraig) != Aig_ManConst1(p->pAigFraig) );
+    pJob->pObj  = pObj;
+    pJob->pRepr = pObjRepr;
+    pBatches[pObj->Id] = iBatch;
+    return 1;
+}
+void Dch_ManSweepMt( Dch_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[DCH_CTX_NUM];
+    int status;
+#endif
+    Dch_ThData_t ThData[DCH_CTX_NUM];
+    Dch_ThPool_t Pool, * pPool = &Pool;
+    Dch_Man_t * pCtxs[DCH_CTX_NUM];
+    Dch_Job_t pJobs[DCH_CTX_NUM * DCH_CTX_JOBS];
+    int nJobsMax = DCH_CTX_NUM * DCH_CTX_JOBS;
+    int nThreads = Abc_MinInt( Abc_MaxInt(p->pPars->nThreads, 1), DCH_CTX_NUM );
+    Bar_Progress_t * pProgress = NULL;
+    Vec_Int_t * vDelayed = Vec_IntAlloc( 100 );
+    Vec_Int_t * vNext = Vec_IntAlloc( 100 );
+    Aig_Obj_t * pObj;
+    int * pBatches;
+    int i, k, Id, nJobs, nScanned, iBatch, RetValue;
+    int iNext = 0, iLast = Aig_ManObjNumMax(p->pAigTotal);
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    // map constants and PIs
+    p->pAigFraig = Aig_ManStart( Aig_ManObjNumMax(p->pAigTotal) );
+    Aig_ManCleanData( p->pAigTotal );
+    Aig_ManConst1(p->pAigTotal)->pData = Aig_ManConst1(p->pAigFraig);
+    Aig_ManForEachCi( p->pAigTotal, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( p->pAigFraig );
+    p->pCexVals = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    pBatches = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    // start the solver contexts and the threads
+    for ( i = 0; i < DCH_CTX_NUM; i++ )
+        pCtxs[i] = Dch_ManCtxStart( p );
+    for ( i = 0; i < nJobsMax; i++ )
+        pJobs[i].vCex = Vec_IntAlloc( 100 );
+    memset( pPool, 0, sizeof(Dch_ThPool_t) );
+    pPool->pCtxs    = pCtxs;
+    pPool->pJobs    = pJobs;
+    pPool->nThreads = nThreads;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+#endif
+    for ( i = 1; i < nThreads; i++ )
+    {
+        ThData[i].pPool   = pPool;
+        ThData[i].iThread = i;
+#ifdef ABC_USE_PTHREADS
+        status = pthread_create( WorkerThread + i, NULL, Dch_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+#endif
+    }
+    // sweep internal nodes in batches; the nodes depending on the checks 
+    // of the batch are delayed until the next batch
+    pProgress = Bar_ProgressStart( stdout, Aig_ManObjNumMax(p->pAigTotal) );
+    for ( iBatch = 1; iNext < iLast || Vec_IntSize(vDelayed) > 0; iBatch++ )
+    {
+        Bar_ProgressUpdate( pProgress, iNext, NULL );
+        nJobs = 0;
+        Vec_IntClear( vNext );
+        Vec_IntForEachEntry( vDelayed, Id, k )
+        {
+            if ( nJobs == nJobsMax )
+            {
+                Vec_IntPush( vNext, Id );
+                continue;
+            }
+            RetValue = Dch_ManAddNode( p, Aig_ManObj(p->pAigTotal, Id), pBatches, iBatch, pJobs + nJobs );
+            if ( RetValue == -1 )
+                Vec_IntPush( vNext, Id );
+            else
+                nJobs += RetValue;
+        }
+        for ( nScanned = 0; nJobs < nJobsMax && nScanned < p->pPars->nNodesAhead && iNext < iLast; iNext++ )
+        {
+            pObj = Aig_ManObj( p->pAigTotal, iNext );
+            if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+                continue;
+            nScanned++;
+            RetValue = Dch_ManAddNode( p, pObj, pBatches, iBatch, pJobs + nJobs );
+            if ( RetValue == -1 )
+                Vec_IntPush( vNext, iNext );
+            else
+                nJobs += RetValue;
+        }
+        ABC_SWAP( Vec_Int_t *, vDelayed, vNext );
+        if ( nJobs )
+            Dch_ManRunBatch( p, pPool, nJobs );
+    }
+    Bar_ProgressStop( pProgress );
+    // stop the threads and the solver contexts
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+#endif
+    for ( i = 0; i < DCH_CTX_NUM; i++ )
+        Dch_ManCtxStop( p, pCtxs[i] );
+    for ( i = 0; i < nJobsMax; i++ )
+        Vec_IntFree( pJobs[i].vCex );
+    Vec_IntFree( vDelayed );
+    Vec_IntFree( vNext );
+    ABC_FREE( p->pCexVals );
+    ABC_FREE( pBatches );
+    // update the representatives of the nodes (makes classes invalid)
+    ABC_FREE( p->pAigTotal->pReprs );
+    p->pAigTotal->pReprs = p->pReprsProved;
+    p->pReprsProved = NULL;
+    // clean the mark
+    Aig_ManCleanMarkB( p->pAigTotal );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
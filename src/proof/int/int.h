@@ -67,6 +67,8 @@ struct Inter_ManParams_t_
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
     char * pFileName;   // file name to dump interpolant
+    int  RunId;         // id of this run
+    int(*pFuncStop)(int); // callback to terminate
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -205,6 +205,15 @@ p->timeEqu += Abc_Clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was terminated by the callback.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -264,6 +273,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // terminated
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was terminated by the callback.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -70,6 +70,8 @@ struct Inter_Man_t_
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
+    int              RunId;        // id of this run
+    int(*pFuncStop)(int);          // callback to terminate
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -50,6 +50,7 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nWorkers;         // the number of threads sharing the outputs
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
@@ -84,6 +85,9 @@ struct Pdr_Par_t_
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
     char * pInvFileName;  // invariable file name
+    int nCheckInterval;   // the interval between checkpoints, in seconds
+    char * pCheckFileName; // the checkpoint file written during the run
+    char * pResumeFileName; // the checkpoint file to resume from
 };
 
 ////////////////////////////////////////////////////////////////////////
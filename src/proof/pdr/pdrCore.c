@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nWorkers       =       0;  // the number of threads sharing the outputs
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -80,6 +81,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nDropOuts      =       0;  // the number of timed out outputs
     pPars->timeLastSolved =       0;  // last one solved
     pPars->pInvFileName   =    NULL;  // invariant file name
+    pPars->nCheckInterval =      60;  // the interval between checkpoints
 }
 
 /**Function*************************************************************
@@ -986,6 +988,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            // publish the clause to other workers
+            if ( p->pShare )
+                Pdr_ShrExport( p, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1022,6 +1027,7 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             return -1;
         if ( p->pPars->nTimeOutGap && p->pPars->timeLastSolved && Abc_Clock() > p->pPars->timeLastSolved + p->pPars->nTimeOutGap * CLOCKS_PER_SEC )
             return -1;
+        Pdr_ManCheckpoint( p, 0 );
     }
     return 1;
 }
@@ -1047,7 +1053,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
     abctime clkStart = Abc_Clock(), clkOne = 0;
     p->timeToStop = p->pPars->nTimeOut ? p->pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
-    assert( Vec_PtrSize(p->vSolvers) == 0 );
+    p->timeToCheck = p->pPars->nCheckInterval ? p->pPars->nCheckInterval * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    assert( Vec_PtrSize(p->vSolvers) == Vec_VecSize(p->vClauses) );
     // in the multi-output mode, mark trivial POs (those fed by const0) as solved 
     if ( p->pPars->fSolveAll )
         Saig_ManForEachPo( p->pAig, pObj, iFrame )
@@ -1060,7 +1067,19 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             }
     // create the first timeframe
     p->pPars->timeLastSolved = Abc_Clock();
-    Pdr_ManCreateSolver( p, (iFrame = 0) );
+    if ( Vec_VecSize(p->vClauses) == 0 )
+        Pdr_ManCreateSolver( p, (iFrame = 0) );
+    else // the timeframes were restored from a checkpoint
+    {
+        iFrame = Vec_VecSize(p->vClauses) - 1;
+        if ( p->pPars->fUseAbs && iFrame >= 1 )
+        {
+            p->vAbsFlops  = Vec_IntStart( Saig_ManRegNum(p->pAig) );
+            p->vMapFf2Ppi = Vec_IntStartFull( Saig_ManRegNum(p->pAig) );
+            p->vMapPpi2Ff = Vec_IntAlloc( 100 );
+            IPdr_ManRestoreAbsFlops( p );
+        }
+    }
     while ( 1 )
     {
         int fRefined = 0;
@@ -1286,8 +1305,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
             Pdr_ManPrintClauses( p, 0 );
         }
-        // push clauses into this timeframe
-        RetValue = Pdr_ManPushClauses( p );
+        // import clauses proved by other workers
+        if ( p->pShare && Pdr_ShrImport( p, iFrame ) == -1 )
+            RetValue = -1;
+        else // push clauses into this timeframe
+            RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1330,6 +1352,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         }
         if ( p->pPars->fVerbose )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
+        Pdr_ManCheckpoint( p, 0 );
 
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
@@ -1413,8 +1436,28 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nWorkers > 1 && Saig_ManPoNum(pAig) > 1 && !pPars->pCheckFileName && !pPars->pResumeFileName )
+        return Pdr_ManSolvePar( pAig, pPars );
     p = Pdr_ManStart( pAig, pPars, NULL );
+    if ( pPars->pResumeFileName )
+    {
+        Vec_Vec_t * vClauses = Pdr_ManReadCheckpoint( p, pPars->pResumeFileName );
+        if ( vClauses == NULL )
+        {
+            Pdr_ManStop( p );
+            return -1;
+        }
+        if ( Vec_VecSize(vClauses) > 0 )
+            IPdr_ManRestoreClauses( p, vClauses, NULL );
+        else
+            Vec_VecFree( vClauses );
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Resuming from %d timeframes restored from checkpoint file \"%s\".\n", 
+                Vec_VecSize(p->vClauses), pPars->pResumeFileName );
+    }
     RetValue = Pdr_ManSolveInt( p );
+    if ( RetValue == -1 )
+        Pdr_ManCheckpoint( p, 1 );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
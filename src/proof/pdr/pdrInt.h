@@ -70,6 +70,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
+typedef struct Pdr_Shr_t_  Pdr_Shr_t;
 
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
@@ -140,6 +141,11 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // parallel solving
+    Pdr_Shr_t * pShare;    // clause store shared with other workers
+    int         iWorker;   // the index of this worker
+    int         nExported; // the number of clauses published
+    int         nImported; // the number of clauses imported
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -161,6 +167,7 @@ struct Pdr_Man_t_
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
+    abctime     timeToCheck;
     // time stats
     abctime     tSat;
     abctime     tSatSat;
@@ -202,6 +209,10 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
+/*=== pdrIncr.c ==========================================================*/
+extern int             IPdr_ManRestoreAbsFlops( Pdr_Man_t * p );
+extern int             IPdr_ManRestoreClauses( Pdr_Man_t * p, Vec_Vec_t * vClauses, Vec_Int_t * vMap );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -211,11 +222,18 @@ extern Vec_Str_t *     Pdr_ManDumpString( Pdr_Man_t * p );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Vec_Int_t *     Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce );
+extern int             Pdr_ManWriteCheckpoint( Pdr_Man_t * p, char * pFileName );
+extern void            Pdr_ManCheckpoint( Pdr_Man_t * p, int fForce );
+extern Vec_Vec_t *     Pdr_ManReadCheckpoint( Pdr_Man_t * p, char * pFileName );
 /*=== pdrMan.c ==========================================================*/
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPth.c ==========================================================*/
+extern void            Pdr_ShrExport( Pdr_Man_t * p, Pdr_Set_t * pCube );
+extern int             Pdr_ShrImport( Pdr_Man_t * p, int k );
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -30,6 +30,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PDR_CHECK_VERSION  2   // the version of the checkpoint format
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -462,6 +464,212 @@ Vec_Str_t * Pdr_ManDumpString( Pdr_Man_t * p )
     return vStr;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the timeframe clauses into a checkpoint file.]
+
+  Description [The file starts with the signature "PDR" followed by the
+  version number, the numbers of PIs, POs, and flops, the structural 
+  hash of the AIG, and the number of timeframes.
+  For each timeframe, it lists the number of cubes, and for each cube,
+  the number of literals followed by the sorted flop literals, the first
+  one as it is and the other ones as the differences with the previous
+  one. All numbers are written using the variable-length encoding of
+  the binary AIGER format. The file is first written under a temporary
+  name and then renamed, so that an interrupted run leaves the previous
+  checkpoint intact.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+int Pdr_ManWriteCheckpoint( Pdr_Man_t * p, char * pFileName )
+{
+    FILE * pFile;
+    Vec_Str_t * vStr;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    char * pFileTemp;
+    int i, k, m, nWritten;
+    vStr = Vec_StrAlloc( 1000 );
+    Vec_StrPush( vStr, 'P' );
+    Vec_StrPush( vStr, 'D' );
+    Vec_StrPush( vStr, 'R' );
+    Gia_AigerWriteUnsigned( vStr, PDR_CHECK_VERSION );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManPiNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManPoNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManRegNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Aig_ManStructHash(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Vec_VecSize(p->vClauses) );
+    Vec_VecForEachLevel( p->vClauses, vArrayK, k )
+    {
+        Gia_AigerWriteUnsigned( vStr, Vec_PtrSize(vArrayK) );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            Gia_AigerWriteUnsigned( vStr, pCube->nLits );
+            for ( m = 0; m < pCube->nLits; m++ )
+                Gia_AigerWriteUnsigned( vStr, m ? pCube->Lits[m] - pCube->Lits[m-1] : pCube->Lits[m] );
+        }
+    }
+    // write into a temporary file
+    pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing the checkpoint.\n", pFileTemp );
+        Vec_StrFree( vStr );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    nWritten = fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
+    fclose( pFile );
+    if ( nWritten != Vec_StrSize(vStr) )
+    {
+        Abc_Print( 1, "Writing the checkpoint into file \"%s\" has failed.\n", pFileTemp );
+        Vec_StrFree( vStr );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+#ifdef WIN32
+    remove( pFileName );
+#endif
+    if ( rename( pFileTemp, pFileName ) )
+        Abc_Print( 1, "Cannot rename file \"%s\" into \"%s\".\n", pFileTemp, pFileName );
+    else if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Checkpoint with %d timeframes (%d bytes) was written into file \"%s\".\n", 
+            Vec_VecSize(p->vClauses), Vec_StrSize(vStr), pFileName );
+    Vec_StrFree( vStr );
+    ABC_FREE( pFileTemp );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the checkpoint if its time has come.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+void Pdr_ManCheckpoint( Pdr_Man_t * p, int fForce )
+{
+    if ( p->pPars->pCheckFileName == NULL )
+        return;
+    // zero interval means that the checkpoint is written only at the end
+    if ( !fForce && (p->pPars->nCheckInterval == 0 || Abc_Clock() < p->timeToCheck) )
+        return;
+    Pdr_ManWriteCheckpoint( p, p->pPars->pCheckFileName );
+    p->timeToCheck = p->pPars->nCheckInterval ? p->pPars->nCheckInterval * CLOCKS_PER_SEC + Abc_Clock(): 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the timeframe clauses from a checkpoint file.]
+
+  Description [Returns NULL if the file cannot be read, if it was 
+  written for a different design, or if some of its cubes are malformed
+  or contain the initial state.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+Vec_Vec_t * Pdr_ManReadCheckpoint( Pdr_Man_t * p, char * pFileName )
+{
+    FILE * pFile;
+    Vec_Vec_t * vClauses = NULL;
+    Pdr_Set_t * pCube;
+    unsigned char * pBuffer, * pPos, * pEnd;
+    int i, k, m, nFileSize, nFrames, nCubes, nLits, Lit, Diff;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open checkpoint file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    // the trailing zero bytes terminate a truncated number and cover
+    // a truncated header (at most six numbers of five bytes each)
+    pBuffer = ABC_CALLOC( unsigned char, nFileSize + 32 );
+    nFileSize = fread( pBuffer, 1, nFileSize, pFile );
+    fclose( pFile );
+    pPos = pBuffer + 3;
+    pEnd = pBuffer + nFileSize;
+    if ( nFileSize < 3 || strncmp( (char *)pBuffer, "PDR", 3 ) || Gia_AigerReadUnsigned(&pPos) != PDR_CHECK_VERSION )
+    {
+        Abc_Print( 1, "File \"%s\" is not a PDR checkpoint.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return NULL;
+    }
+    if ( (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManPiNum(p->pAig) || 
+         (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManPoNum(p->pAig) || 
+         (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManRegNum(p->pAig) ||
+         Gia_AigerReadUnsigned(&pPos) != Aig_ManStructHash(p->pAig) )
+    {
+        Abc_Print( 1, "Checkpoint file \"%s\" was written for a different design.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return NULL;
+    }
+    nFrames  = Gia_AigerReadUnsigned( &pPos );
+    // each timeframe takes at least one byte
+    if ( pPos > pEnd || nFrames < 0 || nFrames > pEnd - pPos )
+    {
+        Abc_Print( 1, "Checkpoint file \"%s\" is corrupted.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return NULL;
+    }
+    vClauses = Vec_VecStart( nFrames );
+    for ( k = 0; k < nFrames && pPos < pEnd; k++ )
+    {
+        nCubes = Gia_AigerReadUnsigned( &pPos );
+        for ( i = 0; i < nCubes && pPos < pEnd; i++ )
+        {
+            nLits = Gia_AigerReadUnsigned( &pPos );
+            if ( nLits < 0 || nLits > 2 * Saig_ManRegNum(p->pAig) )
+                break;
+            pCube = Pdr_SetAlloc( nLits );
+            pCube->nLits  = nLits;
+            pCube->nTotal = nLits;
+            pCube->nRefs  = 1;
+            for ( Lit = m = 0; m < nLits && pPos < pEnd; m++ )
+            {
+                Diff = Gia_AigerReadUnsigned( &pPos );
+                if ( m > 0 && Diff == 0 )
+                    break;
+                Lit += Diff;
+                if ( Lit < 0 || Lit >= 2 * Saig_ManRegNum(p->pAig) )
+                    break;
+                pCube->Lits[m] = Lit;
+                pCube->Sign |= ((word)1 << (Lit % 63));
+            }
+            Vec_VecPush( vClauses, k, pCube );
+            // the cube should be well-formed and disjoint from the init state
+            if ( m < nLits || Pdr_SetIsInit( pCube, -1 ) )
+                break;
+        }
+        if ( i < nCubes )
+            break;
+    }
+    if ( k < nFrames || pPos > pEnd )
+    {
+        Abc_Print( 1, "Checkpoint file \"%s\" is corrupted.\n", pFileName );
+        Vec_VecForEachEntry( Pdr_Set_t *, vClauses, pCube, i, k )
+            Pdr_SetDeref( pCube );
+        Vec_VecFree( vClauses );
+        vClauses = NULL;
+    }
+    ABC_FREE( pBuffer );
+    return vClauses;
+}
+
 
 /**Function*************************************************************
 
@@ -0,0 +1,510 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded solving of multi-output problems.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PDR_SHR_CHUNK   (1 << 12)   // the number of cubes in one chunk
+#define PDR_SHR_CHUNKS  (1 << 10)   // the max number of chunks per worker
+#define PDR_SHR_RUNS          64    // the max number of concurrent parallel runs
+
+// the cubes are published without locking: each log is written only by
+// its owner, which stores the cube before advancing the counter
+#if defined(__GNUC__) || defined(__clang__)
+#define PDR_SHR_BARRIER()  __sync_synchronize()
+#else
+#define PDR_SHR_BARRIER()
+#endif
+
+// cubes published by one worker
+typedef struct Pdr_ShrLog_t_ Pdr_ShrLog_t;
+struct Pdr_ShrLog_t_
+{
+    Pdr_Set_t **    pChunks[PDR_SHR_CHUNKS]; // append-only storage (chunks never move)
+    volatile int    nCubes;                  // the number of published cubes
+    int *           pRead;                   // the number of cubes seen from each worker
+};
+
+// clause store shared by the workers
+struct Pdr_Shr_t_
+{
+    int             nWorkers;   // the number of workers
+    Pdr_ShrLog_t *  pLogs;      // one log for each worker
+    volatile int    fStop;      // set when the workers should quit
+    int             RunId;      // the caller's run id
+    int(*pFuncStop)(int);       // the caller's callback to terminate
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the shared clause store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Pdr_Shr_t * Pdr_ShrStart( int nWorkers, Pdr_Par_t * pPars )
+{
+    Pdr_Shr_t * p = ABC_CALLOC( Pdr_Shr_t, 1 );
+    int i;
+    p->nWorkers  = nWorkers;
+    p->pLogs     = ABC_CALLOC( Pdr_ShrLog_t, nWorkers );
+    p->RunId     = pPars->RunId;
+    p->pFuncStop = pPars->pFuncStop;
+    for ( i = 0; i < nWorkers; i++ )
+        p->pLogs[i].pRead = ABC_CALLOC( int, nWorkers );
+    return p;
+}
+static void Pdr_ShrStop( Pdr_Shr_t * p )
+{
+    int i, k;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        for ( k = 0; k < p->pLogs[i].nCubes; k++ )
+            Pdr_SetDeref( p->pLogs[i].pChunks[k / PDR_SHR_CHUNK][k % PDR_SHR_CHUNK] );
+        for ( k = 0; k < PDR_SHR_CHUNKS; k++ )
+            ABC_FREE( p->pLogs[i].pChunks[k] );
+        ABC_FREE( p->pLogs[i].pRead );
+    }
+    ABC_FREE( p->pLogs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a clause derived by this worker.]
+
+  Description [Only the owner appends to its log, so no locking is needed.
+  PI literals are not published because they only matter for deriving
+  counter-examples. When the log is full, the clause is dropped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ShrExport( Pdr_Man_t * p, Pdr_Set_t * pCube )
+{
+    Pdr_ShrLog_t * pLog = p->pShare->pLogs + p->iWorker;
+    Pdr_Set_t * pDup;
+    int iChunk = pLog->nCubes / PDR_SHR_CHUNK;
+    if ( iChunk == PDR_SHR_CHUNKS )
+        return;
+    if ( pLog->pChunks[iChunk] == NULL )
+        pLog->pChunks[iChunk] = ABC_ALLOC( Pdr_Set_t *, PDR_SHR_CHUNK );
+    pDup = Pdr_SetDup( pCube );
+    pDup->nTotal = pDup->nLits;
+    pLog->pChunks[iChunk][pLog->nCubes % PDR_SHR_CHUNK] = pDup;
+    PDR_SHR_BARRIER();
+    pLog->nCubes++;
+    p->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports clauses published by other workers into frame k.]
+
+  Description [Frames of different workers are not related, so a clause
+  is added only after checking that it is inductive relative to frame k-1
+  of this worker. Returns the number of imported clauses, or -1 if
+  a resource limit was reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ShrImport( Pdr_Man_t * p, int k )
+{
+    Pdr_ShrLog_t * pLog = p->pShare->pLogs + p->iWorker;
+    Pdr_Set_t * pCube, * pDup;
+    int w, c, i, nCubes, RetValue, Counter = 0;
+    if ( k == 0 )
+        return 0;
+    for ( w = 0; w < p->pShare->nWorkers; w++ )
+    {
+        if ( w == p->iWorker )
+            continue;
+        nCubes = p->pShare->pLogs[w].nCubes;
+        PDR_SHR_BARRIER();
+        for ( c = pLog->pRead[w]; c < nCubes; c++ )
+        {
+            pCube = p->pShare->pLogs[w].pChunks[c / PDR_SHR_CHUNK][c % PDR_SHR_CHUNK];
+            if ( Pdr_SetIsInit(pCube, -1) )
+                continue;
+            if ( Pdr_ManCheckContainment( p, k, pCube ) )
+                continue;
+            RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, p->pPars->nConfLimit, 0, 1 );
+            if ( RetValue == -1 )
+            {
+                pLog->pRead[w] = c;
+                return -1;
+            }
+            if ( RetValue == 0 ) // does not hold in this worker
+                continue;
+            pDup = Pdr_SetDup( pCube );
+            Vec_VecPush( p->vClauses, k, pDup );   // consume ref
+            for ( i = 1; i <= k; i++ )
+                Pdr_ManSolverAddClause( p, i, pDup );
+            Counter++;
+        }
+        pLog->pRead[w] = nCubes;
+    }
+    p->nImported += Counter;
+    return Counter;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nWorkers = pPars->nWorkers;
+    pPars->nWorkers = 0;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nWorkers = nWorkers;
+    return RetValue;
+}
+
+#else // pthreads are used
+
+// information given to the thread
+typedef struct Pdr_ThData_t_
+{
+    Aig_Man_t *  pAig;       // the worker's outputs with all flops
+    Vec_Int_t *  vOuts;      // the original indexes of the outputs
+    Pdr_Par_t    Pars;       // the worker's parameters
+    Pdr_Shr_t *  pShare;     // the shared clause store
+    int          iWorker;    // the index of this worker
+    int          RetValue;   // the result
+    int          nFrames;    // the number of frames explored
+    int          nCubes;     // the number of clauses derived
+    int          nExported;  // the number of clauses published
+    int          nImported;  // the number of clauses imported
+    Vec_Ptr_t *  vCexes;     // the counter-examples in the multi-output mode
+    Vec_Int_t *  vInv;       // the inductive invariant if the outputs are proved
+    abctime      clkTotal;   // the runtime of the worker
+} Pdr_ThData_t;
+
+// the stores of the parallel runs in progress
+static pthread_mutex_t s_PdrShrMutex = PTHREAD_MUTEX_INITIALIZER;
+static Pdr_Shr_t * volatile s_PdrShrRuns[PDR_SHR_RUNS];
+
+// call back procedure used by the workers
+static int Pdr_ShrCallBackToStop( int RunId )
+{
+    Pdr_Shr_t * p = s_PdrShrRuns[RunId];
+    return p->fStop || (p->pFuncStop && p->pFuncStop(p->RunId));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the AIG while keeping the given outputs.]
+
+  Description [All flops are kept in the original order, so that clauses
+  derived by one worker can be used by the others.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Pdr_ManDupOutputs( Aig_Man_t * p, Vec_Int_t * vOuts )
+{
+    Aig_Man_t * pNew;
+    Aig_Obj_t * pObj;
+    int i, iOut;
+    assert( Aig_ManRegNum(p) > 0 );
+    // create the new manager
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    // create the PIs
+    Aig_ManCleanData( p );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    // duplicate internal nodes
+    Aig_ManForEachNode( p, pObj, i )
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    // create the POs
+    Vec_IntForEachEntry( vOuts, iOut, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(Aig_ManCo(p, iOut)) );
+    // create register inputs
+    Saig_ManForEachLi( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    Aig_ManCleanup( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs owned by one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_WorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Man_t * p;
+    abctime clk = Abc_Clock();
+    p = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    p->pShare  = pThData->pShare;
+    p->iWorker = pThData->iWorker;
+    pThData->RetValue = Pdr_ManSolveInt( p );
+    // in the single-result mode, the first CEX ends the run
+    if ( pThData->RetValue == 0 && !pThData->Pars.fSolveAll )
+        pThData->pShare->fStop = 1;
+    pThData->nFrames   = pThData->Pars.iFrame;
+    pThData->nCubes    = p->nCubes;
+    pThData->nExported = p->nExported;
+    pThData->nImported = p->nImported;
+    pThData->vCexes    = p->vCexes;  p->vCexes = NULL;
+    if ( pThData->RetValue == 1 )
+        pThData->vInv  = Pdr_ManDeriveInfinityClauses( p, 0 );
+    Pdr_ManStop( p );
+    pThData->clkTotal  = Abc_Clock() - clk;
+    // quit this thread
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the multi-output problem using several threads.]
+
+  Description [The outputs are distributed among the workers. Each worker
+  runs PDR on its outputs and publishes the clauses it derives. The others
+  import them at their frontier frames after checking that they are
+  inductive relative to the previous frame. The results are mapped back
+  to the original outputs in the same way as Pdr_ManSolve() reports them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ThData_t * pThData;
+    pthread_t * pThreads;
+    Pdr_Shr_t * pShare;
+    Abc_Cex_t * pCex;
+    Vec_Ptr_t * vCexes = NULL;
+    Vec_Int_t * vInv = NULL;
+    int i, k, iOut, status, RunId, nWorkersUser = pPars->nWorkers, nWorkers = Abc_MinInt( pPars->nWorkers, Saig_ManPoNum(pAig) );
+    int nDone = 0, nFrameMax = 0, RetValue = -1;
+    assert( nWorkers > 1 );
+    if ( pPars->fUseAbs || pPars->fDumpInv || pPars->fUseBridge || pPars->pFuncOnFail || Saig_ManConstrNum(pAig) )
+    {
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Parallel PDR does not support the selected options; solving outputs on one thread.\n" );
+        pPars->nWorkers = 0;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+        pPars->nWorkers = nWorkersUser;
+        return RetValue;
+    }
+    // register the shared store
+    pShare = Pdr_ShrStart( nWorkers, pPars );
+    status = pthread_mutex_lock(&s_PdrShrMutex);  assert( status == 0 );
+    for ( RunId = 0; RunId < PDR_SHR_RUNS; RunId++ )
+        if ( s_PdrShrRuns[RunId] == NULL )
+            break;
+    if ( RunId < PDR_SHR_RUNS )
+        s_PdrShrRuns[RunId] = pShare;
+    status = pthread_mutex_unlock(&s_PdrShrMutex);  assert( status == 0 );
+    if ( RunId == PDR_SHR_RUNS )
+    {
+        Pdr_ShrStop( pShare );
+        pPars->nWorkers = 0;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+        pPars->nWorkers = nWorkersUser;
+        return RetValue;
+    }
+    // distribute the outputs and prepare the workers
+    pThData  = ABC_CALLOC( Pdr_ThData_t, nWorkers );
+    pThreads = ABC_ALLOC( pthread_t, nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+        pThData[i].vOuts = Vec_IntAlloc( Saig_ManPoNum(pAig) / nWorkers + 1 );
+    for ( k = 0; k < Saig_ManPoNum(pAig); k++ )
+        Vec_IntPush( pThData[k % nWorkers].vOuts, k );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        pThData[i].pAig      = Pdr_ManDupOutputs( pAig, pThData[i].vOuts );
+        pThData[i].Pars      = *pPars;
+        pThData[i].Pars.nWorkers     = 0;
+        pThData[i].Pars.fVerbose     = 0;
+        pThData[i].Pars.fVeryVerbose = 0;
+        pThData[i].Pars.fNotVerbose  = 1;
+        pThData[i].Pars.fSilent      = 1;
+        pThData[i].Pars.vOutMap      = NULL;
+        pThData[i].Pars.nFailOuts    = 0;
+        pThData[i].Pars.nDropOuts    = 0;
+        pThData[i].Pars.nProveOuts   = 0;
+        pThData[i].Pars.RunId        = RunId;
+        pThData[i].Pars.pFuncStop    = Pdr_ShrCallBackToStop;
+        pThData[i].pShare    = pShare;
+        pThData[i].iWorker   = i;
+        pThData[i].RetValue  = -1;
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Solving %d outputs using %d workers.\n", Saig_ManPoNum(pAig), nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Pdr_WorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );
+        assert( status == 0 );
+    }
+    // unregister the shared store
+    status = pthread_mutex_lock(&s_PdrShrMutex);  assert( status == 0 );
+    s_PdrShrRuns[RunId] = NULL;
+    status = pthread_mutex_unlock(&s_PdrShrMutex);  assert( status == 0 );
+    // collect the results
+    pPars->nFailOuts = pPars->nDropOuts = pPars->nProveOuts = 0;
+    if ( pPars->fSolveAll )
+    {
+        vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+        pPars->vOutMap = Vec_IntAlloc( Saig_ManPoNum(pAig) );
+        Vec_IntFill( pPars->vOutMap, Saig_ManPoNum(pAig), -1 );
+    }
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Pdr_ThData_t * pData = pThData + i;
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Worker %2d : Outs =%6d. Frames =%5d. Clauses =%7d. Exported =%7d. Imported =%7d.  %-9s  ",
+                i, Vec_IntSize(pData->vOuts), pData->nFrames, pData->nCubes, pData->nExported, pData->nImported,
+                pData->RetValue == 1 ? "proved" : (pData->RetValue == 0 ? "disproved" : "undecided") );
+            Abc_PrintTime( 1, "Time", pData->clkTotal );
+        }
+        nDone    += (pData->RetValue == 1);
+        nFrameMax = Abc_MaxInt( nFrameMax, pData->nFrames );
+        if ( pPars->fSolveAll )
+        {
+            pPars->nFailOuts  += pData->Pars.nFailOuts;
+            pPars->nDropOuts  += pData->Pars.nDropOuts;
+            Vec_IntForEachEntry( pData->vOuts, iOut, k )
+            {
+                int Status = Vec_IntEntry( pData->Pars.vOutMap, k );
+                Vec_IntWriteEntry( pPars->vOutMap, iOut, Status == -2 ? -1 : Status ); // unknown -> undec
+                pCex = (Abc_Cex_t *)Vec_PtrEntry( pData->vCexes, k );
+                if ( pCex && pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+                    pCex->iPo = iOut;
+                if ( pCex && !pPars->fNotVerbose )
+                    Abc_Print( 1, "Output %d was asserted by worker %d.\n", iOut, i );
+                Vec_PtrWriteEntry( vCexes, iOut, pCex );
+            }
+            Vec_PtrFree( pData->vCexes );
+            Vec_IntFree( pData->Pars.vOutMap );
+        }
+        else if ( pData->RetValue == 0 && pAig->pSeqModel == NULL )
+        {
+            pAig->pSeqModel = pData->pAig->pSeqModel;
+            pData->pAig->pSeqModel = NULL;
+            pAig->pSeqModel->iPo = Vec_IntEntry( pData->vOuts, pAig->pSeqModel->iPo );
+        }
+        // the invariant of the whole design is the conjunction of the workers' invariants
+        if ( pData->vInv )
+        {
+            if ( vInv == NULL )
+            {
+                vInv = Vec_IntAlloc( 1000 );
+                Vec_IntPush( vInv, 0 );
+            }
+            // skip the clause count in the first entry and the flop count in the last entry
+            Vec_IntAddToEntry( vInv, 0, Vec_IntEntry(pData->vInv, 0) );
+            for ( k = 1; k < Vec_IntSize(pData->vInv) - 1; k++ )
+                Vec_IntPush( vInv, Vec_IntEntry(pData->vInv, k) );
+            Vec_IntFree( pData->vInv );
+        }
+        Aig_ManStop( pData->pAig );
+        Vec_IntFree( pData->vOuts );
+    }
+    if ( pPars->fSolveAll )
+    {
+        pPars->nProveOuts = Vec_IntCountEntry( pPars->vOutMap, 1 );
+        pAig->vSeqModelVec = vCexes;
+        if ( pPars->nProveOuts == Saig_ManPoNum(pAig) )
+            RetValue = 1;
+        else if ( pPars->nFailOuts > 0 )
+            RetValue = 0;
+    }
+    else if ( pAig->pSeqModel )
+        RetValue = 0;
+    else if ( nDone == nWorkers )
+        RetValue = 1;
+    if ( RetValue == 1 && vInv )
+    {
+        Vec_IntPush( vInv, Aig_ManRegNum(pAig) );
+        Abc_FrameSetInv( vInv );
+    }
+    else
+        Vec_IntFreeP( &vInv );
+    pPars->iFrame = nFrameMax - 1;
+    ABC_FREE( pThreads );
+    ABC_FREE( pThData );
+    Pdr_ShrStop( pShare );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -47,6 +47,7 @@ void Ssw_ManSetDefaultParams( Ssw_Pars_t * p )
     memset( p, 0, sizeof(Ssw_Pars_t) );
     p->nPartSize      =       0;  // size of the partition
     p->nOverSize      =       0;  // size of the overlap between partitions
+    p->nThreads       =       1;  // the number of threads solving partitions
     p->nFramesK       =       1;  // the induction depth
     p->nFramesAddSim  =       2;  // additional frames to simulate
     p->fConstrs       =       0;  // treat the last nConstrs POs as seq constraints
@@ -444,6 +445,7 @@ Aig_Man_t * Ssw_SignalCorrespondence( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         assert( pPars->nFramesK > 0 );
         // perform partitioning
         if ( (pPars->nPartSize > 0 && pPars->nPartSize < Aig_ManRegNum(pAig))
+             || (pPars->nPartSize == 0 && pPars->nThreads > 1 && Aig_ManRegNum(pAig) > 1 && !pPars->fConstrs)
              || (pAig->vClockDoms && Vec_VecSize(pAig->vClockDoms) > 0)  )
             return Ssw_SignalCorrespondencePart( pAig, pPars );
     }
@@ -21,6 +21,16 @@
 #include "sswInt.h"
 #include "aig/ioa/ioa.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -34,7 +44,7 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    [Performs partitioned sequential SAT sweeping.]
+  Synopsis    [Derives one partition.]
 
   Description []
                
@@ -42,6 +52,243 @@ ABC_NAMESPACE_IMPL_START
 
   SeeAlso     []
 
+***********************************************************************/
+static Aig_Man_t * Ssw_SignalCorrespondencePartDerive( Aig_Man_t * pAig, Vec_Int_t * vPart, int * pnCountPis, int * pnCountRegs, int ** ppMapBack, int fVerbose )
+{
+    Aig_Man_t * pTemp;
+    pTemp = Aig_ManRegCreatePart( pAig, vPart, pnCountPis, pnCountRegs, ppMapBack );
+    Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+    // create the projection of 1-hot registers
+    if ( pAig->vOnehots )
+        pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
+    return pTemp;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the partitions one after another.]
+
+  Description [The proved equivalences are recorded in pAig.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ssw_SignalCorrespondencePartSt( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, int fVerbose )
+{
+    Aig_Man_t * pTemp, * pNew;
+    Vec_Int_t * vPart;
+    int * pMapBack;
+    int i, nCountPis, nCountRegs, nClasses;
+    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
+    {
+        pTemp = Ssw_SignalCorrespondencePartDerive( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack, fVerbose );
+        // run SSW
+        if (nCountPis>0) {
+            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
+            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
+            if ( fVerbose )
+                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                    i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
+            Aig_ManStop( pNew );
+        }
+        Aig_ManStop( pTemp );
+        ABC_FREE( pMapBack );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the partitions concurrently.]
+
+  Description [The partitions are derived by this thread and solved by 
+  the worker threads, each with its own copy of the parameters. The 
+  proved equivalences are recorded in pAig in the order of partitions, 
+  so that the result does not depend on which partition is solved first.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define SSW_THR_MAX 100
+typedef struct Ssw_PartThPool_t_
+{
+    int             nDone;      // the number of partitions solved so far
+    int             fStop;      // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart;  // signals the threads about a new partition
+    pthread_cond_t  CondDone;   // signals the main thread about a solved partition
+} Ssw_PartThPool_t;
+typedef struct Ssw_PartThData_t_
+{
+    Ssw_PartThPool_t * pPool;
+    Aig_Man_t *  pPart;
+    Aig_Man_t *  pNew;
+    Ssw_Pars_t   Pars;
+    int          iPart;
+    int          Status;        // the thread is busy (protected by the mutex)
+} Ssw_PartThData_t;
+void * Ssw_PartWorkerThread( void * pArg )
+{
+    Ssw_PartThData_t * pThData = (Ssw_PartThData_t *)pArg;
+    Ssw_PartThPool_t * pPool = pThData->pPool;
+    int fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( !pThData->Status && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        fStop = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        pThData->pNew = Ssw_SignalCorrespondence( pThData->pPart, &pThData->Pars );
+        pthread_mutex_lock( &pPool->Mutex );
+        pThData->Status = 0;
+        pPool->nDone++;
+        pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+static void Ssw_SignalCorrespondencePartMt( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, int fVerbose )
+{
+    pthread_t WorkerThread[SSW_THR_MAX];
+    Ssw_PartThData_t ThData[SSW_THR_MAX];
+    Ssw_PartThPool_t Pool, * pPool = &Pool;
+    int nParts = Vec_PtrSize( vResult );
+    int nThreads = Abc_MinInt( Abc_MinInt(pPars->nThreads, SSW_THR_MAX), nParts );
+    Aig_Man_t ** ppParts = ABC_CALLOC( Aig_Man_t *, nParts );
+    int ** ppMapBacks = ABC_CALLOC( int *, nParts );
+    int * pCountPis  = ABC_CALLOC( int, nParts );
+    int * pCountRegs = ABC_CALLOC( int, nParts );
+    int * pIters     = ABC_CALLOC( int, nParts );
+    int * pDone      = ABC_CALLOC( int, nParts );
+    Vec_Int_t * vPart;
+    int i, k, status, fBusy, nClasses, nDoneSeen, iPart = 0, iDone = 0;
+    // start the threads
+    memset( pPool, 0, sizeof(Ssw_PartThPool_t) );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pPool  = pPool;
+        ThData[i].pPart  = NULL;
+        ThData[i].pNew   = NULL;
+        ThData[i].Pars   = *pPars;
+        ThData[i].Pars.nThreads = 1;
+        ThData[i].iPart  = -1;
+        ThData[i].Status = 0;
+        status = pthread_create( WorkerThread + i, NULL, Ssw_PartWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    while ( iDone < nParts )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        nDoneSeen = pPool->nDone;
+        pthread_mutex_unlock( &pPool->Mutex );
+        for ( k = 0; k < nThreads; k++ )
+        {
+            pthread_mutex_lock( &pPool->Mutex );
+            fBusy = ThData[k].Status;
+            pthread_mutex_unlock( &pPool->Mutex );
+            if ( fBusy )
+                continue;
+            // collect the solved partition
+            if ( ThData[k].iPart >= 0 )
+            {
+                Aig_ManStop( ThData[k].pNew );
+                pIters[ThData[k].iPart] = ThData[k].Pars.nIters;
+                pDone[ThData[k].iPart] = 1;
+                ThData[k].iPart = -1;
+            }
+            // give the thread the next partition that has true PIs
+            for ( ; iPart < nParts; iPart++ )
+            {
+                vPart = (Vec_Int_t *)Vec_PtrEntry( vResult, iPart );
+                ppParts[iPart] = Ssw_SignalCorrespondencePartDerive( pAig, vPart, pCountPis + iPart, pCountRegs + iPart, ppMapBacks + iPart, fVerbose );
+                if ( pCountPis[iPart] > 0 )
+                    break;
+                pDone[iPart] = 1;
+            }
+            if ( iPart == nParts )
+                continue;
+            ThData[k].pPart  = ppParts[iPart];
+            ThData[k].iPart  = iPart++;
+            pthread_mutex_lock( &pPool->Mutex );
+            ThData[k].Status = 1;
+            pthread_cond_broadcast( &pPool->CondStart );
+            pthread_mutex_unlock( &pPool->Mutex );
+        }
+        // record the equivalences of the solved partitions in their order
+        for ( ; iDone < nParts && pDone[iDone]; iDone++ )
+        {
+            vPart = (Vec_Int_t *)Vec_PtrEntry( vResult, iDone );
+            if ( pCountPis[iDone] > 0 )
+            {
+                nClasses = Aig_TransferMappedClasses( pAig, ppParts[iDone], ppMapBacks[iDone] );
+                if ( fVerbose )
+                    Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                        iDone, Vec_IntSize(vPart), Aig_ManCiNum(ppParts[iDone])-Vec_IntSize(vPart), pCountPis[iDone], pCountRegs[iDone], Aig_ManNodeNum(ppParts[iDone]), pIters[iDone], nClasses );
+            }
+            Aig_ManStop( ppParts[iDone] );
+            ABC_FREE( ppMapBacks[iDone] );
+        }
+        // the next partition is being solved, so wait until a thread is done
+        if ( iDone < nParts )
+        {
+            pthread_mutex_lock( &pPool->Mutex );
+            while ( pPool->nDone == nDoneSeen )
+                pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+            pthread_mutex_unlock( &pPool->Mutex );
+        }
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPool->Mutex );
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    ABC_FREE( ppParts );
+    ABC_FREE( ppMapBacks );
+    ABC_FREE( pCountPis );
+    ABC_FREE( pCountRegs );
+    ABC_FREE( pIters );
+    ABC_FREE( pDone );
+}
+
+#else // pthreads are not used
+
+static void Ssw_SignalCorrespondencePartMt( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, int fVerbose )
+{
+    Ssw_SignalCorrespondencePartSt( pAig, vResult, pPars, fVerbose );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned sequential SAT sweeping.]
+
+  Description [When several threads are used, the partitions are solved 
+  concurrently, and the partition size, if not given, is chosen to have 
+  one partition per thread. The equivalences across the partitions are 
+  not detected, so the merged result is checked again with the registers 
+  partitioned anew, for as long as this reduces the AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 {
@@ -50,9 +297,8 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
     Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vResult;
     Vec_Int_t * vPart;
-    int * pMapBack;
     int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
+    int nPartSize, nPartSizeUser, fVerbose;
     abctime clk = Abc_Clock();
     if ( pPars->fConstrs )
     {
@@ -60,8 +306,10 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         return NULL;
     }
     // save parameters
-    nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
+    nPartSize = nPartSizeUser = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
+    if ( nPartSize == 0 && pPars->nThreads > 1 )
+        nPartSize = Abc_MaxInt( 2, (Aig_ManRegNum(pAig) + pPars->nThreads - 1) / pPars->nThreads );
     // generate partitions
     if ( pAig->vClockDoms )
     {
@@ -97,37 +345,33 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 
     // perform SSW with partitions
     Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
-    {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        // create the projection of 1-hot registers
-        if ( pAig->vOnehots )
-            pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
-        // run SSW
-        if (nCountPis>0) {
-            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
-            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
-            if ( fVerbose )
-                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                    i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
-            Aig_ManStop( pNew );
-        }
-        Aig_ManStop( pTemp );
-        ABC_FREE( pMapBack );
-    }
+    if ( pPars->nThreads > 1 )
+        Ssw_SignalCorrespondencePartMt( pAig, vResult, pPars, fVerbose );
+    else
+        Ssw_SignalCorrespondencePartSt( pAig, vResult, pPars, fVerbose );
     // remap the AIG
     pNew = Aig_ManDupRepr( pAig, 0 );
     Aig_ManSeqCleanup( pNew );
 //    Aig_ManPrintStats( pAig );
 //    Aig_ManPrintStats( pNew );
     Vec_VecFree( (Vec_Vec_t *)vResult );
-    pPars->nPartSize = nPartSize;
     pPars->fVerbose = fVerbose;
     if ( fVerbose )
     {
         ABC_PRT( "Total time", Abc_Clock() - clk );
     }
+    // check the merged result again
+    if ( pPars->nThreads > 1 && nPartSize < Aig_ManRegNum(pNew) && 
+         Aig_ManRegNum(pNew) + Aig_ManNodeNum(pNew) < Aig_ManRegNum(pAig) + Aig_ManNodeNum(pAig) )
+    {
+        if ( fVerbose )
+            Abc_Print( 1, "Checking the merged result with %d registers and %d nodes.\n", Aig_ManRegNum(pNew), Aig_ManNodeNum(pNew) );
+        pPars->nPartSize = nPartSizeUser;
+        pTemp = Ssw_SignalCorrespondencePart( pNew, pPars );
+        Aig_ManStop( pNew );
+        pNew = pTemp;
+    }
+    pPars->nPartSize = nPartSizeUser;
     return pNew;
 }
 
@@ -106,6 +106,7 @@ struct Saig_ParBmc_t_
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         nProcs;         // the number of frames solved concurrently
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
@@ -120,6 +121,9 @@ struct Saig_ParBmc_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     int         RunId;          // BMC id in this run 
     int(*pFuncStop)(int);       // callback to terminate
+    int         nCheckInterval; // the interval between checkpoints, in seconds
+    char *      pCheckFileName; // the checkpoint file written during the run
+    char *      pResumeFileName;// the checkpoint file to resume from
 };
 
  
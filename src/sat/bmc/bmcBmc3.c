@@ -27,6 +27,16 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -68,6 +78,7 @@ struct Gia_ManBmc_t_
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    Vec_Int_t *       vClauses;    // clauses not loaded into the solvers (pipelined mode)
 };
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
@@ -89,6 +100,8 @@ void Gia_ManReportProgress( FILE * pFile, int prop_no, int depth )
 #define SAIG_TER_ONE 2
 #define SAIG_TER_UND 3
 
+#define SAIG_BMC_CHECK_VERSION 2   // the version of the checkpoint format
+
 static inline int Saig_ManBmcSimInfoNot( int Value )
 {
     if ( Value == SAIG_TER_ZER )
@@ -834,6 +847,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
     Vec_IntFree( p->vId2Lit );
+    Vec_IntFreeP( &p->vClauses );
     ABC_FREE( p->pSopSizes );
     ABC_FREE( p->pSops[1] );
     ABC_FREE( p->pSops );
@@ -1029,6 +1043,11 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 if ( !bmcg_sat_solver_addclause( p->pSat3, ClaLits, nClaLits ) )
                     assert( 0 );
             }
+            else if ( p->vClauses )
+            {
+                Vec_IntPush( p->vClauses, nClaLits );
+                Vec_IntPushArray( p->vClauses, ClaLits, nClaLits );
+            }
             else
             {
                 if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
@@ -1280,6 +1299,8 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
             Saig_ManBmcCreateCnf_rec( p, pTemp, iFrame-f );
     Lit = Saig_ManBmcLiteral( p, pObj, iFrame );
     // extend the SAT solver
+    if ( p->vClauses )
+        return Lit;
     if ( p->pSat2 )
         satoko_setnvars( p->pSat2, p->nSatVars );
     else if ( p->pSat3 )
@@ -1353,6 +1374,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nFailOuts      =     0;    // the number of failed outputs
     p->nDropOuts      =     0;    // the number of timed out outputs
     p->timeLastSolved =     0;    // time when the last one was solved
+    p->nCheckInterval =    60;    // the interval between checkpoints
 }
 
 /**Function*************************************************************
@@ -1447,6 +1469,522 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Pipelined BMC solving several frames concurrently.]
+
+  Description [The main thread unrolls the upcoming timeframes and
+  records the new clauses, while each worker owns a SAT solver and
+  checks all outputs of one timeframe. Before a frame is handed to
+  a worker, the clauses it has not seen yet are loaded into its
+  solver. Up to nProcs frames are in flight; the results are
+  committed in the order of frames, so the first failing frame and
+  its counter-example are the same as in the sequential engine.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+int Saig_ManBmcScalableMt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    int RetValue, nProcs = pPars->nProcs;
+    pPars->nProcs = 0;
+    RetValue = Saig_ManBmcScalable( pAig, pPars );
+    pPars->nProcs = nProcs;
+    return RetValue;
+}
+
+#else // pthreads are used
+
+#define BMC3_THR_MAX 100
+
+typedef struct Bmc3_ThPool_t_
+{
+    int             nDone;     // the number of frames solved so far
+    int             fStop;     // the threads should quit
+    pthread_mutex_t Mutex;
+    pthread_cond_t  CondStart; // signals the threads about a new frame
+    pthread_cond_t  CondDone;  // signals the main thread about a solved frame
+} Bmc3_ThPool_t;
+
+typedef struct Bmc3_ThData_t_
+{
+    Bmc3_ThPool_t * pPool;     // the thread pool
+    Gia_ManBmc_t *  p;         // BMC manager
+    sat_solver *    pSat;      // the solver of this thread
+    Vec_Int_t *     vLits;     // output literals of the frame being solved
+    int             iFrame;    // the frame being solved (-1 = idle)
+    int             iClause;   // the first clause not loaded into the solver
+    int             iThread;   // thread number
+    int             iPo;       // the failed output
+    int             status;    // solving status
+    int             fWorking;  // the thread is busy (protected by the mutex)
+} Bmc3_ThData_t;
+
+void * Saig_ManBmcWorkerThread( void * pArg )
+{
+    Bmc3_ThData_t * pThData = (Bmc3_ThData_t *)pArg;
+    Bmc3_ThPool_t * pPool = pThData->pPool;
+    int i, k, Lit, status, fStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( !pThData->fWorking && !pPool->fStop )
+            pthread_cond_wait( &pPool->CondStart, &pPool->Mutex );
+        fStop = pPool->fStop;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( fStop )
+            return NULL;
+        pThData->status = l_False;
+        pThData->iPo = -1;
+        Vec_IntForEachEntry( pThData->vLits, Lit, i )
+        {
+            if ( Lit == 0 )
+                continue;
+            if ( Lit == 1 )
+            {
+                pThData->status = l_True;
+                pThData->iPo = i;
+                break;
+            }
+            sat_solver_compress( pThData->pSat );
+            pThData->status = sat_solver_solve( pThData->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pThData->p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            if ( pThData->status != l_False )
+            {
+                pThData->iPo = i;
+                break;
+            }
+            // add final unit clause
+            Lit = lit_neg( Lit );
+            status = sat_solver_addclause( pThData->pSat, &Lit, &Lit + 1 );
+            assert( status );
+            // add learned units
+            for ( k = 0; k < veci_size(&pThData->pSat->unit_lits); k++ )
+            {
+                Lit = veci_begin(&pThData->pSat->unit_lits)[k];
+                status = sat_solver_addclause( pThData->pSat, &Lit, &Lit + 1 );
+                assert( status );
+            }
+            veci_resize(&pThData->pSat->unit_lits, 0);
+            sat_solver_compress( pThData->pSat );
+        }
+        pthread_mutex_lock( &pPool->Mutex );
+        pThData->fWorking = 0;
+        pPool->nDone++;
+        pthread_cond_signal( &pPool->CondDone );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+void Saig_ManBmcUnrollFrame( Gia_ManBmc_t * p, int f, Vec_Int_t * vLits )
+{
+    Aig_Obj_t * pObj;
+    unsigned * pInfo;
+    int i;
+    Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
+    Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
+    Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+    Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(p->pAig), SAIG_TER_ONE );
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
+    if ( f == 0 )
+    {
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
+            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
+        }
+    }
+    Vec_IntClear( vLits );
+    Saig_ManForEachPo( p->pAig, pObj, i )
+        Vec_IntPush( vLits, Saig_ManBmcCreateCnf(p, pObj, f) );
+}
+
+void Saig_ManBmcLoadClauses( Gia_ManBmc_t * p, Bmc3_ThData_t * pThData )
+{
+    int * pClause, * pLimit;
+    sat_solver_setnvars( pThData->pSat, p->nSatVars );
+    pClause = Vec_IntArray( p->vClauses ) + pThData->iClause;
+    pLimit  = Vec_IntLimit( p->vClauses );
+    for ( ; pClause < pLimit; pClause += pClause[0] + 1 )
+        if ( !sat_solver_addclause( pThData->pSat, pClause + 1, pClause + 1 + pClause[0] ) )
+            assert( 0 );
+    pThData->iClause = Vec_IntSize( p->vClauses );
+}
+
+void Saig_ManBmcCompactClauses( Gia_ManBmc_t * p, Bmc3_ThData_t * ThData, int nProcs )
+{
+    int i, iMin = Vec_IntSize( p->vClauses );
+    for ( i = 0; i < nProcs; i++ )
+        iMin = Abc_MinInt( iMin, ThData[i].iClause );
+    if ( iMin == 0 || iMin < Vec_IntSize(p->vClauses) / 2 )
+        return;
+    memmove( Vec_IntArray(p->vClauses), Vec_IntArray(p->vClauses) + iMin, sizeof(int) * (Vec_IntSize(p->vClauses) - iMin) );
+    Vec_IntShrink( p->vClauses, Vec_IntSize(p->vClauses) - iMin );
+    for ( i = 0; i < nProcs; i++ )
+        ThData[i].iClause -= iMin;
+}
+
+int Saig_ManBmcScalableMt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    pthread_t WorkerThread[BMC3_THR_MAX];
+    Bmc3_ThData_t ThData[BMC3_THR_MAX], * pThData;
+    Bmc3_ThPool_t Pool, * pPool = &Pool;
+    Gia_ManBmc_t * p;
+    Vec_Wec_t * vFrameLits;
+    sat_solver * pSatMain;
+    int nProcs = Abc_MinInt( pPars->nProcs, BMC3_THR_MAX );
+    int nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    int i, status, RetValue = -1, fDone = 0, fAssigned = 0, fUnrolled = 0, nDoneSeen;
+    abctime clk, clkOther = 0, clkTotal = Abc_Clock();
+    abctime nTimeToStop = Saig_ManBmcTimeToStop( pPars, pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0 );
+    // create BMC manager recording the clauses
+    p = Saig_Bmc3ManStart( pAig, 0, pPars->nConfLimit, 0, 0 );
+    p->pPars = pPars;
+    p->vClauses = Vec_IntAlloc( 1 << 16 );
+    vFrameLits = Vec_WecAlloc( 100 );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\" with %d threads. PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n", 
+            nProcs, Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), p->nObjNums );
+        Abc_Print( 1, "Params: FramesMax = %d. ConfLimit = %d. TimeOut = %d.\n", 
+            pPars->nFramesMax, pPars->nConfLimit, pPars->nTimeOut );
+    } 
+    // start threads
+    memset( pPool, 0, sizeof(Bmc3_ThPool_t) );
+    pthread_mutex_init( &pPool->Mutex, NULL );
+    pthread_cond_init( &pPool->CondStart, NULL );
+    pthread_cond_init( &pPool->CondDone, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Bmc3_ThData_t) );
+        ThData[i].pPool   = pPool;
+        ThData[i].p       = p;
+        ThData[i].pSat    = sat_solver_new();
+        ThData[i].vLits   = Vec_IntAlloc( Saig_ManPoNum(pAig) );
+        ThData[i].iFrame  = -1;
+        ThData[i].iThread = i;
+        ThData[i].pSat->nLearntStart = pPars->nLearnedStart;
+        ThData[i].pSat->nLearntDelta = pPars->nLearnedDelta;
+        ThData[i].pSat->nLearntRatio = pPars->nLearnedPerce;
+        ThData[i].pSat->nLearntMax   = ThData[i].pSat->nLearntStart;
+        ThData[i].pSat->fNoRestarts  = pPars->fNoRestarts;
+        ThData[i].pSat->RunId        = pPars->RunId;
+        ThData[i].pSat->pFuncStop    = pPars->pFuncStop;
+        if ( nTimeToStop )
+            sat_solver_set_runtime_limit( ThData[i].pSat, nTimeToStop );
+        status = pthread_create( WorkerThread + i, NULL, Saig_ManBmcWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    pPars->timeLastSolved = Abc_Clock();
+    while ( fDone < nFramesMax )
+    {
+        // commit the next frame if it is solved
+        pThData = NULL;
+        pthread_mutex_lock( &pPool->Mutex );
+        nDoneSeen = pPool->nDone;
+        for ( i = 0; i < nProcs; i++ )
+            if ( ThData[i].iFrame == fDone && !ThData[i].fWorking )
+                pThData = ThData + i;
+        pthread_mutex_unlock( &pPool->Mutex );
+        if ( pThData != NULL )
+        {
+            pThData->iFrame = -1;
+            if ( pThData->status == l_True )
+            {
+                RetValue = 0;
+                // the counter-example is read from the solver that found it;
+                // inputs added by unrolling later frames are set to zero
+                sat_solver_setnvars( pThData->pSat, p->nSatVars );
+                pSatMain = p->pSat;
+                p->pSat = pThData->pSat;
+                ABC_FREE( pAig->pSeqModel );
+                pAig->pSeqModel = Saig_ManGenerateCex( p, fDone, pThData->iPo );
+                p->pSat = pSatMain;
+            }
+            if ( pPars->fVerbose )
+            {
+                Abc_Print( 1, "%4d %s : ", fDone, pThData->status == l_Undef ? "-" : "+" );
+                Abc_Print( 1, "Thr =%3d. ",    pThData->iThread );
+                Abc_Print( 1, "Var =%8.0f. ",  (double)sat_solver_nvars(pThData->pSat) );
+                Abc_Print( 1, "Cla =%9.0f. ",  (double)pThData->pSat->stats.clauses );
+                Abc_Print( 1, "Conf =%7.0f. ", (double)pThData->pSat->stats.conflicts );
+                Abc_Print( 1, "Learn =%7.0f. ",(double)pThData->pSat->stats.learnts );
+                Abc_Print( 1, "%4.0f MB",      4.0*(fDone+1)*p->nObjNums /(1<<20) );
+                Abc_Print( 1, "%4.0f MB",      1.0*sat_solver_memory(pThData->pSat)/(1<<20) );
+                Abc_Print( 1, "%9.2f sec ",    1.0*(Abc_Clock() - clkTotal)/CLOCKS_PER_SEC );
+                Abc_Print( 1, "\n" );
+                fflush( stdout );
+            }
+            if ( pThData->status != l_False )
+                break;
+            pPars->iFrame = fDone++;
+            // stop BMC after exploring all reachable states
+            if ( Aig_ManRegNum(pAig) < 30 && fDone == (1 << Aig_ManRegNum(pAig)) )
+            {
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+                RetValue = 1;
+                break;
+            }
+            continue;
+        }
+        // check for timeout
+        if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+            break;
+        }
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Bmc3 got callbacks.\n" );
+            break;
+        }
+        // hand the next unrolled frame to an idle thread
+        pThData = NULL;
+        if ( fAssigned < fUnrolled )
+            for ( i = 0; i < nProcs; i++ )
+                if ( ThData[i].iFrame == -1 )
+                {
+                    pThData = ThData + i;
+                    break;
+                }
+        if ( pThData != NULL )
+        {
+            Saig_ManBmcLoadClauses( p, pThData );
+            Saig_ManBmcCompactClauses( p, ThData, nProcs );
+            Vec_IntClear( pThData->vLits );
+            Vec_IntAppend( pThData->vLits, Vec_WecEntry(vFrameLits, fAssigned) );
+            pThData->iFrame = fAssigned++;
+            pthread_mutex_lock( &pPool->Mutex );
+            pThData->fWorking = 1;
+            pthread_cond_broadcast( &pPool->CondStart );
+            pthread_mutex_unlock( &pPool->Mutex );
+            continue;
+        }
+        // unroll one more frame while the threads are solving
+        if ( fUnrolled < nFramesMax && fUnrolled <= fDone + nProcs )
+        {
+            clk = Abc_Clock();
+            Saig_ManBmcUnrollFrame( p, fUnrolled, Vec_WecPushLevel(vFrameLits) );
+            clkOther += Abc_Clock() - clk;
+            fUnrolled++;
+            continue;
+        }
+        // nothing to do until a thread is done (the solvers observe the timeout and the callback)
+        pthread_mutex_lock( &pPool->Mutex );
+        while ( pPool->nDone == nDoneSeen )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+        pthread_mutex_unlock( &pPool->Mutex );
+    }
+    if ( RetValue == -1 && fDone == nFramesMax )
+        pPars->iFrame = nFramesMax - 1;
+    // interrupt the threads solving later frames and wait for them
+    pthread_mutex_lock( &pPool->Mutex );
+    for ( i = 0; i < nProcs; i++ )
+        if ( ThData[i].fWorking )
+            sat_solver_set_runtime_limit( ThData[i].pSat, 1 );
+    for ( i = 0; i < nProcs; i++ )
+        while ( ThData[i].fWorking )
+            pthread_cond_wait( &pPool->CondDone, &pPool->Mutex );
+    // stop threads
+    pPool->fStop = 1;
+    pthread_cond_broadcast( &pPool->CondStart );
+    pthread_mutex_unlock( &pPool->Mutex );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        sat_solver_delete( ThData[i].pSat );
+        Vec_IntFree( ThData[i].vLits );
+    }
+    pthread_cond_destroy( &pPool->CondStart );
+    pthread_cond_destroy( &pPool->CondDone );
+    pthread_mutex_destroy( &pPool->Mutex );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Runtime:  " );
+        Abc_Print( 1, "CNF = %.1f sec (%.1f %%)  ", 1.0*clkOther/CLOCKS_PER_SEC, 100.0*clkOther/(Abc_Clock() - clkTotal) );
+        Abc_Print( 1, "Frames = %d  Solved = %d", fUnrolled, fDone );
+        Abc_Print( 1, "\n" );
+    }
+    Vec_WecFree( vFrameLits );
+    Saig_Bmc3ManStop( p );
+    fflush( stdout );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the BMC checkpoint.]
+
+  Description [The file starts with the signature "BMC" followed by the 
+  version number, the numbers of PIs, POs, and flops, the structural hash
+  of the AIG, the number of
+  timeframes completely explored for all unsolved outputs, and the status
+  of each output (0 = undecided; 1 = disproved; 2 = timed out). All numbers
+  are written using the variable-length encoding of the binary AIGER
+  format. The file is first written under a temporary name and then 
+  renamed, so that an interrupted run leaves the previous checkpoint intact.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcWriteCheckpoint( Gia_ManBmc_t * p, char * pFileName, int nFramesDone )
+{
+    FILE * pFile;
+    Vec_Str_t * vStr;
+    char * pFileTemp;
+    int i, Status, nWritten;
+    vStr = Vec_StrAlloc( 100 );
+    Vec_StrPush( vStr, 'B' );
+    Vec_StrPush( vStr, 'M' );
+    Vec_StrPush( vStr, 'C' );
+    Gia_AigerWriteUnsigned( vStr, SAIG_BMC_CHECK_VERSION );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManPiNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManPoNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Saig_ManRegNum(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, Aig_ManStructHash(p->pAig) );
+    Gia_AigerWriteUnsigned( vStr, nFramesDone );
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
+            Status = 1;
+        else if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
+            Status = 2;
+        else
+            Status = 0;
+        Gia_AigerWriteUnsigned( vStr, Status );
+    }
+    pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing the checkpoint.\n", pFileTemp );
+        Vec_StrFree( vStr );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    nWritten = fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
+    fclose( pFile );
+    if ( nWritten != Vec_StrSize(vStr) )
+    {
+        Abc_Print( 1, "Writing the checkpoint into file \"%s\" has failed.\n", pFileTemp );
+        Vec_StrFree( vStr );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+#ifdef WIN32
+    remove( pFileName );
+#endif
+    if ( rename( pFileTemp, pFileName ) )
+        Abc_Print( 1, "Cannot rename file \"%s\" into \"%s\".\n", pFileTemp, pFileName );
+    else if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Checkpoint with %d explored timeframes was written into file \"%s\".\n", nFramesDone, pFileName );
+    Vec_StrFree( vStr );
+    ABC_FREE( pFileTemp );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the BMC checkpoint.]
+
+  Description [Marks the disproved and timed out outputs as solved and
+  returns the number of explored timeframes, or -1 if the checkpoint 
+  cannot be used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcReadCheckpoint( Gia_ManBmc_t * p, char * pFileName )
+{
+    FILE * pFile;
+    unsigned char * pBuffer, * pPos, * pEnd;
+    int i, nFileSize, nFramesDone, Status, nFailOuts = 0, nDropOuts = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open checkpoint file \"%s\".\n", pFileName );
+        return -1;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    // the trailing zero bytes terminate a truncated number and cover
+    // a truncated header (at most six numbers of five bytes each)
+    pBuffer = ABC_CALLOC( unsigned char, nFileSize + 32 );
+    nFileSize = fread( pBuffer, 1, nFileSize, pFile );
+    fclose( pFile );
+    pPos = pBuffer + 3;
+    pEnd = pBuffer + nFileSize;
+    if ( nFileSize < 3 || strncmp( (char *)pBuffer, "BMC", 3 ) || Gia_AigerReadUnsigned(&pPos) != SAIG_BMC_CHECK_VERSION )
+    {
+        Abc_Print( 1, "File \"%s\" is not a BMC checkpoint.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return -1;
+    }
+    if ( (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManPiNum(p->pAig) || 
+         (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManPoNum(p->pAig) || 
+         (int)Gia_AigerReadUnsigned(&pPos) != Saig_ManRegNum(p->pAig) ||
+         Gia_AigerReadUnsigned(&pPos) != Aig_ManStructHash(p->pAig) )
+    {
+        Abc_Print( 1, "Checkpoint file \"%s\" was written for a different design.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return -1;
+    }
+    nFramesDone = Gia_AigerReadUnsigned( &pPos );
+    // each output status is one byte with the value 0, 1, or 2
+    for ( i = 0; i < Saig_ManPoNum(p->pAig) && pPos + i < pEnd; i++ )
+        if ( pPos[i] > 2 )
+            break;
+    if ( pPos > pEnd || nFramesDone < 0 || i < Saig_ManPoNum(p->pAig) || pPos + Saig_ManPoNum(p->pAig) != pEnd )
+    {
+        Abc_Print( 1, "Checkpoint file \"%s\" is corrupted.\n", pFileName );
+        ABC_FREE( pBuffer );
+        return -1;
+    }
+    // read the output statuses
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        Status = Gia_AigerReadUnsigned( &pPos );
+        if ( Status == 1 )
+        {
+            if ( !p->pPars->fSolveAll )
+            {
+                Abc_Print( 1, "Checkpoint file \"%s\" records disproved outputs and can only be resumed with \"-a\".\n", pFileName );
+                ABC_FREE( pBuffer );
+                return -1;
+            }
+            if ( p->vCexes == NULL )
+                p->vCexes = Vec_PtrStart( Saig_ManPoNum(p->pAig) );
+            Vec_PtrWriteEntry( p->vCexes, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            nFailOuts++;
+        }
+        else if ( Status == 2 && p->pTime4Outs )
+        {
+            p->pTime4Outs[i] = 0;
+            nDropOuts++;
+        }
+    }
+    ABC_FREE( pBuffer );
+    p->pPars->nFailOuts += nFailOuts;
+    p->pPars->nDropOuts += nDropOuts;
+    return nFramesDone;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1465,12 +2003,21 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
     unsigned * pInfo;
-    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
+    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0, nFramesDone = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
-    abctime nTimeToStopNG, nTimeToStop;
+    abctime nTimeToStopNG, nTimeToStop, nTimeToCheck;
+    if ( pPars->nProcs >= 1 )
+    {
+        if ( !pPars->fSolveAll && !pPars->fUseSatoko && !pPars->fUseGlucose && !pPars->fUseBridge &&
+             !pPars->nStart && !pPars->nFramesJump && !pPars->nTimeOutOne && !pPars->pLogFileName && 
+             !pPars->pCheckFileName && !pPars->pResumeFileName )
+            return Saig_ManBmcScalableMt( pAig, pPars );
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Concurrent solving of frames (-K) is not compatible with -a, -S, -J, -H, -W, -X, -Y, or non-default SAT solvers, and will not be used.\n" );
+    }
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1504,6 +2051,22 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    if ( pPars->pResumeFileName )
+    {
+        nFramesDone = Saig_ManBmcReadCheckpoint( p, pPars->pResumeFileName );
+        if ( nFramesDone == -1 )
+        {
+            Saig_Bmc3ManStop( p );
+            if ( pLogFile )
+                fclose( pLogFile );
+            return -1;
+        }
+        if ( pPars->nFailOuts )
+            RetValue = 0;
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Resuming from frame %d (%d disproved and %d timed out outputs) restored from checkpoint file \"%s\".\n", 
+                nFramesDone, pPars->nFailOuts, pPars->nDropOuts, pPars->pResumeFileName );
+    }
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",// Sect =%3d.\n", 
@@ -1526,6 +2089,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     // perform frames
     Aig_ManRandom( 1 );
     pPars->timeLastSolved = Abc_Clock();
+    nTimeToCheck = pPars->nCheckInterval ? pPars->nCheckInterval * CLOCKS_PER_SEC + Abc_Clock(): 0;
     for ( f = 0; f < pPars->nFramesMax; f++ )
     {
         // stop BMC after exploring all reachable states
@@ -1575,7 +2139,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
-        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
+        if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) || f < nFramesDone )
             continue;
         // create CNF upfront
         if ( pPars->fSolveAll )
@@ -1860,6 +2424,15 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "\n" );
             fflush( stdout );
         }
+        // remember the frame explored for all outputs
+        if ( !fUnfinished )
+            nFramesDone = f + 1;
+        // zero interval means that the checkpoint is written only at the end
+        if ( pPars->pCheckFileName && pPars->nCheckInterval && Abc_Clock() > nTimeToCheck )
+        {
+            Saig_ManBmcWriteCheckpoint( p, pPars->pCheckFileName, nFramesDone );
+            nTimeToCheck = pPars->nCheckInterval * CLOCKS_PER_SEC + Abc_Clock();
+        }
     }
     // consider the next timeframe
     if ( nJumpFrame && pPars->nStart == 0 )
@@ -1877,6 +2450,8 @@ finish:
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
     }
+    if ( pPars->pCheckFileName && (RetValue == -1 || pPars->fSolveAll) )
+        Saig_ManBmcWriteCheckpoint( p, pPars->pCheckFileName, nFramesDone );
     Saig_Bmc3ManStop( p );
     fflush( stdout );
     if ( pLogFile )
@@ -21,6 +21,7 @@
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
 #include "sat/satoko/satoko.h"
+#include "sat/bsat/satShare.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -77,6 +78,7 @@ struct Bmcs_Man_t_
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
     bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    Sat_Share_t *     pShare;              // learnt clauses exchanged by the solvers
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
@@ -381,6 +383,10 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vFr2Sat, 3*Gia_ManCiNum(pGia) );  
     Vec_IntPush( &p->vFr2Sat, 0 );
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
+#ifndef ABC_USE_EXT_SOLVERS
+    if ( pPars->nProcs > 1 )
+        p->pShare = Sat_ShareStart( pPars->nProcs, 8, 2 );
+#endif
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         // modify parameters to get different SAT solvers
@@ -393,6 +399,8 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         p->pSats[i]->SolverType = i;
 #else
         satoko_configure(p->pSats[i], &opts);
+        if ( p->pShare )
+            satoko_set_share( p->pSats[i], Sat_ShareClient(p->pShare, i), Sat_ShareExport, Sat_ShareImport );
 #endif
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
@@ -413,6 +421,8 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+    if ( p->pShare )
+        Sat_ShareStop( p->pShare );
     ABC_FREE( p );
 }
 
@@ -904,6 +914,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
+    if ( pPars->fVerbose && p->pShare )
+        Sat_SharePrintStats( p->pShare );
     Bmcs_ManStop( p );
     return RetValue;
 }
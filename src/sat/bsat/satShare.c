@@ -0,0 +1,242 @@
+/**CFile****************************************************************
+
+  FileName    [satShare.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Learnt clause exchange between concurrent SAT solvers.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: satShare.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "satShare.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SAT_SHARE_RING   (1 << 16)              // the ring size in words (a power of 2)
+#define SAT_SHARE_MASK   (SAT_SHARE_RING - 1)
+#define SAT_SHARE_SIZE   32                     // the largest clause that can be shared
+#define SAT_SHARE_REC    (SAT_SHARE_SIZE + 2)   // the largest record (size, LBD, literals)
+
+// the ring is written only by its owner, which stores the record
+// before advancing the head; the readers never write into it
+#if defined(__GNUC__) || defined(__clang__)
+#define SAT_SHARE_BARRIER()  __sync_synchronize()
+#else
+#define SAT_SHARE_BARRIER()
+#endif
+
+// the exchange point of one solver
+typedef struct Sat_ShareCli_t_ Sat_ShareCli_t;
+struct Sat_ShareCli_t_
+{
+    Sat_Share_t *     pMan;                         // the shared manager
+    int               iSolver;                      // the solver owning this ring
+    int *             pRing;                        // the ring of records
+    volatile unsigned iHead;                        // the number of words written
+    unsigned          pRead[SAT_SHARE_MAX];         // the read positions in the other rings
+    int               iNext;                        // the next ring to read
+    int               pClause[SAT_SHARE_SIZE];      // the last imported clause
+    word              nExported;                    // statistics
+    word              nImported;
+    word              nLost;
+};
+
+struct Sat_Share_t_
+{
+    int               nSolvers;                     // the number of solvers
+    int               nSizeMax;                     // the largest exported clause
+    int               nLbdMax;                      // the largest LBD of an exported clause
+    Sat_ShareCli_t *  pClis[SAT_SHARE_MAX];         // the exchange points
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the exchange for the given number of solvers.]
+
+  Description [Only clauses with at most nSizeMax literals and with LBD
+  not exceeding nLbdMax are exchanged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Share_t * Sat_ShareStart( int nSolvers, int nSizeMax, int nLbdMax )
+{
+    Sat_Share_t * p;
+    int i;
+    assert( nSolvers > 0 && nSolvers <= SAT_SHARE_MAX );
+    p = ABC_CALLOC( Sat_Share_t, 1 );
+    p->nSolvers = nSolvers;
+    p->nSizeMax = Abc_MinInt( Abc_MaxInt(nSizeMax, 1), SAT_SHARE_SIZE );
+    p->nLbdMax  = nLbdMax;
+    for ( i = 0; i < nSolvers; i++ )
+    {
+        p->pClis[i] = ABC_CALLOC( Sat_ShareCli_t, 1 );
+        p->pClis[i]->pMan    = p;
+        p->pClis[i]->iSolver = i;
+        p->pClis[i]->pRing   = ABC_ALLOC( int, SAT_SHARE_RING );
+    }
+    return p;
+}
+void Sat_ShareStop( Sat_Share_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        ABC_FREE( p->pClis[i]->pRing );
+        ABC_FREE( p->pClis[i] );
+    }
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the handle passed to the callbacks of one solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Sat_ShareClient( Sat_Share_t * p, int iSolver )
+{
+    assert( iSolver >= 0 && iSolver < p->nSolvers );
+    return (void *)p->pClis[iSolver];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a learnt clause.]
+
+  Description [Called by the owner of the ring only. Clauses that are
+  too long or have a large LBD are skipped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareExport( void * pClient, int * pLits, int nLits, int Lbd )
+{
+    Sat_ShareCli_t * p = (Sat_ShareCli_t *)pClient;
+    unsigned iHead = p->iHead;
+    int i;
+    if ( nLits == 0 || nLits > p->pMan->nSizeMax || (nLits > 1 && Lbd > p->pMan->nLbdMax) )
+        return;
+    p->pRing[iHead++ & SAT_SHARE_MASK] = nLits;
+    p->pRing[iHead++ & SAT_SHARE_MASK] = Lbd;
+    for ( i = 0; i < nLits; i++ )
+        p->pRing[iHead++ & SAT_SHARE_MASK] = pLits[i];
+    SAT_SHARE_BARRIER();
+    p->iHead = iHead;
+    p->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next clause published by the other solvers.]
+
+  Description [Returns NULL when there are no new clauses. The returned
+  array is valid until the next call. A record is valid only if its
+  writer could not have reached it again while it was being copied;
+  otherwise the reader drops it and jumps to the current head.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int * Sat_ShareImport( void * pClient, int * pnLits, int * pLbd )
+{
+    Sat_ShareCli_t * p = (Sat_ShareCli_t *)pClient, * q;
+    Sat_Share_t * pMan = p->pMan;
+    unsigned iHead, iRead;
+    int i, k, nLits, Lbd;
+    for ( k = 0; k < pMan->nSolvers; k++, p->iNext = (p->iNext + 1) % pMan->nSolvers )
+    {
+        q = pMan->pClis[p->iNext];
+        if ( q == p )
+            continue;
+        while ( (iRead = p->pRead[q->iSolver]) != (iHead = q->iHead) )
+        {
+            SAT_SHARE_BARRIER();
+            if ( iHead - iRead > SAT_SHARE_RING - SAT_SHARE_REC )
+            {
+                p->pRead[q->iSolver] = iHead;
+                p->nLost++;
+                continue;
+            }
+            nLits = q->pRing[iRead & SAT_SHARE_MASK];
+            Lbd   = q->pRing[(iRead + 1) & SAT_SHARE_MASK];
+            if ( nLits > 0 && nLits <= SAT_SHARE_SIZE )
+                for ( i = 0; i < nLits; i++ )
+                    p->pClause[i] = q->pRing[(iRead + 2 + i) & SAT_SHARE_MASK];
+            SAT_SHARE_BARRIER();
+            iHead = q->iHead;
+            if ( iHead - iRead > SAT_SHARE_RING - SAT_SHARE_REC || nLits <= 0 || nLits > SAT_SHARE_SIZE )
+            {
+                p->pRead[q->iSolver] = iHead;
+                p->nLost++;
+                continue;
+            }
+            p->pRead[q->iSolver] = iRead + 2 + nLits;
+            p->nImported++;
+            *pnLits = nLits;
+            *pLbd   = Lbd;
+            return p->pClause;
+        }
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the exchange statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_SharePrintStats( Sat_Share_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+        printf( "Solver %2d :  Exported = %9.0f.  Imported = %9.0f.  Lost = %7.0f.\n", i,
+            (double)p->pClis[i]->nExported, (double)p->pClis[i]->nImported, (double)p->pClis[i]->nLost );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
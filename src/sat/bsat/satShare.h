@@ -0,0 +1,75 @@
+/**CFile****************************************************************
+
+  FileName    [satShare.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Learnt clause exchange between concurrent SAT solvers.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: satShare.h,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satShare_h
+#define ABC__sat__bsat__satShare_h
+
+/*
+    The solvers taking part in the exchange work on the same clause
+    database with the same variable numbering. Each of them owns one ring
+    buffer, which only this solver writes, and reads the rings of the
+    others at restarts. No locks are used: the writer publishes a clause
+    by advancing the head of its ring, and the reader discards a clause
+    if the writer has lapped it while it was being copied.
+
+    The two callbacks below match the clause-sharing hooks of Satoko
+    (satoko_set_share) and Glucose (bmcg_sat_solver_set_share); the
+    manager passed to them is the handle returned by Sat_ShareClient().
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+#define SAT_SHARE_MAX    64      // the largest number of solvers
+
+////////////////////////////////////////////////////////////////////////
+///                    STRUCTURE DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Sat_Share_t_ Sat_Share_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DECLARATIONS                        ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satShare.c ==========================================================*/
+extern Sat_Share_t * Sat_ShareStart( int nSolvers, int nSizeMax, int nLbdMax );
+extern void          Sat_ShareStop( Sat_Share_t * p );
+extern void *        Sat_ShareClient( Sat_Share_t * p, int iSolver );
+extern void          Sat_ShareExport( void * pClient, int * pLits, int nLits, int Lbd );
+extern int *         Sat_ShareImport( void * pClient, int * pnLits, int * pLbd );
+extern void          Sat_SharePrintStats( Sat_Share_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -88,6 +88,7 @@ struct Cnf_Man_t_
     int             nMergeLimit;     // the limit on the size of merged cut
     unsigned *      pTruths[4];      // temporary truth tables
     Vec_Int_t *     vMemory;         // memory for intermediate ISOP representation
+    int             nThreads;        // the number of threads for cuts and clauses (0 = serial)
     abctime         timeCuts; 
     abctime         timeMap;
     abctime         timeSave;
@@ -131,6 +132,7 @@ extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
+extern int             Cnf_DeriveIntoFile( Aig_Man_t * pAig, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals );
 extern void            Cnf_ManPrepare();
 extern Cnf_Man_t *     Cnf_ManRead();
 extern void            Cnf_ManFree();
@@ -185,6 +187,7 @@ extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMappe
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
+extern int             Cnf_ManWriteCnfIntoFile( Cnf_Man_t * p, Vec_Ptr_t * vMapped, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveSimpleForRetiming( Aig_Man_t * p );
 
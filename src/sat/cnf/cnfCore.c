@@ -137,7 +137,7 @@ Cnf_Dat_t * Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs )
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    pMemCuts = Dar_ManComputeCutsMt( pAig, 10, 0, p->nThreads );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
@@ -167,6 +167,55 @@ Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
     Cnf_ManPrepare();
     return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into CNF written directly into a DIMACS file.]
+
+  Description [The file is the same as the one written for the result
+  of Cnf_Derive() with no extra outputs, but the clauses are not stored
+  in memory. Returns 0 if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveIntoFile( Aig_Man_t * pAig, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Cnf_Man_t * p;
+    Vec_Ptr_t * vMapped;
+    Aig_MmFixed_t * pMemCuts;
+    int RetValue;
+    abctime clk;
+    // connect the managers
+    Cnf_ManPrepare();
+    p = s_pManCnf;
+    p->pManAig = pAig;
+
+    // generate cuts for all nodes, assign cost, and find best cuts
+clk = Abc_Clock();
+    pMemCuts = Dar_ManComputeCutsMt( pAig, 10, 0, p->nThreads );
+p->timeCuts = Abc_Clock() - clk;
+
+    // find the mapping
+clk = Abc_Clock();
+    Cnf_DeriveMapping( p );
+p->timeMap = Abc_Clock() - clk;
+
+    // write CNF into the file
+clk = Abc_Clock();
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    RetValue = Cnf_ManWriteCnfIntoFile( p, vMapped, pFileName, fChangePol, pnVars, pnClauses, pnLiterals );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+p->timeSave = Abc_Clock() - clk;
+
+   // reset reference counters
+    Aig_ManResetRefs( pAig );
+    return RetValue;
+}
  
 /**Function*************************************************************
 
@@ -190,7 +239,7 @@ Cnf_Dat_t * Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTt
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, fSkipTtMin, 0 );
+    pMemCuts = Dar_ManComputeCutsMt( pAig, 10, fSkipTtMin, p->nThreads );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
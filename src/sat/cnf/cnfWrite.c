@@ -20,6 +20,16 @@
 
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +37,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CNF_PAR_NODES_MIN 10000   // the smallest mapping written by several threads
+
+static inline int Cnf_Lit2Var( int Lit )        { return (Lit & 1)? -(Lit >> 1)-1 : (Lit >> 1)+1;  }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -183,6 +197,183 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
     return nLits;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Counts the clauses and literals of one mapped node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_ManCountCnfNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pnClauses, int * pnLiterals )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    unsigned uTruth;
+    assert( Aig_ObjIsNode(pObj) );
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        *pnClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
+        *pnClauses += Vec_IntSize(pCut->vIsop[1]);
+    }
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        *pnClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
+        *pnClauses += Vec_IntSize(pCut->vIsop[0]);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of one mapped node.]
+
+  Description [Writes the literals starting from pLits and the clause
+  beginnings starting from *ppClas, which is advanced past the new
+  clauses. Returns the position after the last literal written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Cnf_ManWriteCnfNode( Cnf_Man_t * p, int * pVarNums, Aig_Obj_t * pObj, Vec_Int_t * vSopTemp, int *** ppClas, int * pLits )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    Vec_Int_t * vCover;
+    int ** pClas = *ppClas;
+    int OutVar, pVars[32], k, Cube;
+    unsigned uTruth;
+
+    // save variables of this cut
+    OutVar = pVarNums[ pObj->Id ];
+    for ( k = 0; k < (int)pCut->nFanins; k++ )
+    {
+        pVars[k] = pVarNums[ pCut->pFanins[k] ];
+        assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+    }
+
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[1];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[0];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar + 1; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+    *ppClas = pClas;
+    return pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the mapped nodes using several threads.]
+
+  Description [Each thread writes a contiguous range of nodes directly
+  into the pre-sized clause arrays, starting from the offsets given by
+  pClaBeg and pLitBeg (the prefix sums of the node clause and literal
+  counts), so the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define CNF_THR_MAX 100
+
+typedef struct Cnf_ThData_t_
+{
+    Cnf_Man_t *     p;           // CNF manager
+    Cnf_Dat_t *     pCnf;        // the CNF being written
+    Vec_Ptr_t *     vMapped;     // the mapped nodes
+    int *           pClaBeg;     // the first clause of each node
+    int *           pLitBeg;     // the first literal of each node
+    int             iStart;      // the first node of this thread
+    int             iStop;       // the last node of this thread
+} Cnf_ThData_t;
+
+void * Cnf_ManWriteCnfThread( void * pArg )
+{
+    Cnf_ThData_t * pThData = (Cnf_ThData_t *)pArg;
+    Vec_Int_t * vSopTemp = Vec_IntAlloc( 1 << 16 );
+    int ** pClas = pThData->pCnf->pClauses + pThData->pClaBeg[pThData->iStart];
+    int * pLits  = pThData->pCnf->pClauses[0] + pThData->pLitBeg[pThData->iStart];
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+        pLits = Cnf_ManWriteCnfNode( pThData->p, pThData->pCnf->pVarNums, (Aig_Obj_t *)Vec_PtrEntry(pThData->vMapped, i), vSopTemp, &pClas, pLits );
+    assert( pClas == pThData->pCnf->pClauses + pThData->pClaBeg[pThData->iStop] );
+    assert( pLits == pThData->pCnf->pClauses[0] + pThData->pLitBeg[pThData->iStop] );
+    Vec_IntFree( vSopTemp );
+    return NULL;
+}
+
+void Cnf_ManWriteCnfNodesMt( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Ptr_t * vMapped, int * pClaBeg, int * pLitBeg )
+{
+    pthread_t WorkerThread[CNF_THR_MAX];
+    Cnf_ThData_t ThData[CNF_THR_MAX];
+    int i, status, nThreads = Abc_MinInt( p->nThreads, CNF_THR_MAX );
+    int nPerThread = (Vec_PtrSize(vMapped) + nThreads - 1) / nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].pCnf    = pCnf;
+        ThData[i].vMapped = vMapped;
+        ThData[i].pClaBeg = pClaBeg;
+        ThData[i].pLitBeg = pLitBeg;
+        ThData[i].iStart  = Abc_MinInt( i * nPerThread, Vec_PtrSize(vMapped) );
+        ThData[i].iStop   = Abc_MinInt( (i + 1) * nPerThread, Vec_PtrSize(vMapped) );
+        status = pthread_create( WorkerThread + i, NULL, Cnf_ManWriteCnfThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF for the mapping.]
@@ -199,51 +390,33 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
 {
     int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    int fUseThreads = p->nThreads > 1 && Vec_PtrSize(vMapped) >= CNF_PAR_NODES_MIN;
     Aig_Obj_t * pObj;
     Cnf_Dat_t * pCnf;
-    Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
-    unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
+    Vec_Int_t * vSopTemp;
+    int OutVar, PoVar, * pLits, ** pClas;
+    int * pClaBeg = NULL, * pLitBeg = NULL;
+    int i, nLiterals, nClauses, Number;
 
     // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    nLiterals = 0;
+    nClauses = 0;
+    if ( fUseThreads )
+    {
+        // remember where the clauses of each node begin
+        pClaBeg = ABC_ALLOC( int, Vec_PtrSize(vMapped) + 1 );
+        pLitBeg = ABC_ALLOC( int, Vec_PtrSize(vMapped) + 1 );
+    }
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
     {
-        assert( Aig_ObjIsNode(pObj) );
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
-        }
-        else
-        {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
-            nClauses += Vec_IntSize(pCut->vIsop[1]);
-        }
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
-        }
-        else
-        {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
-            nClauses += Vec_IntSize(pCut->vIsop[0]);
-        }
-//printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
+        if ( pClaBeg )
+            pClaBeg[i] = nClauses, pLitBeg[i] = nLiterals;
+        Cnf_ManCountCnfNode( p, pObj, &nClauses, &nLiterals );
     }
-//printf( "\n" );
+    if ( pClaBeg )
+        pClaBeg[i] = nClauses, pLitBeg[i] = nLiterals;
+    nLiterals += 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses += 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -318,54 +491,25 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     }
 
     // assign the clauses
-    vSopTemp = Vec_IntAlloc( 1 << 16 );
     pLits = pCnf->pClauses[0];
     pClas = pCnf->pClauses;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+#ifdef ABC_USE_PTHREADS
+    if ( fUseThreads )
     {
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
+        Cnf_ManWriteCnfNodesMt( p, pCnf, vMapped, pClaBeg, pLitBeg );
+        pLits += pLitBeg[Vec_PtrSize(vMapped)];
+        pClas += pClaBeg[Vec_PtrSize(vMapped)];
     }
-    Vec_IntFree( vSopTemp );
+    else
+#endif
+    {
+        vSopTemp = Vec_IntAlloc( 1 << 16 );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+            pLits = Cnf_ManWriteCnfNode( p, pCnf->pVarNums, pObj, vSopTemp, &pClas, pLits );
+        Vec_IntFree( vSopTemp );
+    }
+    ABC_FREE( pClaBeg );
+    ABC_FREE( pLitBeg );
  
     // write the constant literal
     OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
@@ -403,6 +547,102 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the mapping directly into a DIMACS file.]
+
+  Description [Produces the same file as Cnf_ManWriteCnf() without extra
+  outputs, followed by Cnf_DataTranformPolarity() when fChangePol is set,
+  and Cnf_DataWriteIntoFile(), but the clauses are printed node by node
+  instead of being collected in Cnf_Dat_t. Returns 0 if the file cannot
+  be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_ManWriteClauseIntoFile( FILE * pFile, int * pVarToPol, int * pBeg, int * pEnd )
+{
+    for ( ; pBeg < pEnd; pBeg++ )
+        fprintf( pFile, "%d ", Cnf_Lit2Var(*pBeg ^ pVarToPol[Abc_Lit2Var(*pBeg)]) );
+    fprintf( pFile, "0\n" );
+}
+int Cnf_ManWriteCnfIntoFile( Cnf_Man_t * p, Vec_Ptr_t * vMapped, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    FILE * pFile;
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vSopTemp, * vLits;
+    int * pVarNums, * pVarToPol, ** pClas = NULL, ** pClasEnd, * pLitsEnd, Lit;
+    int i, k, nClasAlloc = 0, nLiterals = 0, nClauses = 0, Number;
+    pFile = fopen( pFileName, "w" );
+    if ( pFile == NULL )
+    {
+        printf( "Cnf_ManWriteCnfIntoFile(): Output file cannot be opened.\n" );
+        return 0;
+    }
+    // count the number of literals and clauses
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        Cnf_ManCountCnfNode( p, pObj, &nClauses, &nLiterals );
+    nLiterals += 1 + Aig_ManCoNum( p->pManAig );
+    nClauses += 1 + Aig_ManCoNum( p->pManAig );
+    // assign variables in the same order as Cnf_ManWriteCnf()
+    pVarNums = ABC_FALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    Number = 1;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    Aig_ManForEachCi( p->pManAig, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
+    // create map from the variable number to its polarity
+    pVarToPol = ABC_CALLOC( int, Number );
+    Aig_ManForEachObj( p->pManAig, pObj, i )
+        if ( fChangePol && !Aig_ObjIsCo(pObj) && pVarNums[pObj->Id] >= 0 )
+            pVarToPol[ pVarNums[pObj->Id] ] = pObj->fPhase;
+    // write the clauses of each node
+    fprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    fprintf( pFile, "p cnf %d %d\n", Number, nClauses );
+    vSopTemp = Vec_IntAlloc( 1 << 16 );
+    vLits = Vec_IntAlloc( 1 << 10 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        int nClausesNode = 0, nLiteralsNode = 0;
+        Cnf_ManCountCnfNode( p, pObj, &nClausesNode, &nLiteralsNode );
+        Vec_IntGrow( vLits, nLiteralsNode );
+        if ( nClasAlloc < nClausesNode + 1 )
+        {
+            nClasAlloc = 2 * (nClausesNode + 1);
+            pClas = ABC_REALLOC( int *, pClas, nClasAlloc );
+        }
+        pClasEnd = pClas;
+        pLitsEnd = Cnf_ManWriteCnfNode( p, pVarNums, pObj, vSopTemp, &pClasEnd, Vec_IntArray(vLits) );
+        assert( pClasEnd - pClas == nClausesNode );
+        *pClasEnd = pLitsEnd;
+        for ( k = 0; k < nClausesNode; k++ )
+            Cnf_ManWriteClauseIntoFile( pFile, pVarToPol, pClas[k], pClas[k+1] );
+    }
+    // write the constant literal
+    Lit = 2 * pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
+    Cnf_ManWriteClauseIntoFile( pFile, pVarToPol, &Lit, &Lit + 1 );
+    // write the output literals
+    Aig_ManForEachCo( p->pManAig, pObj, i )
+    {
+        Lit = 2 * pVarNums[ Aig_ObjFanin0(pObj)->Id ] + Aig_ObjFaninC0(pObj);
+        Cnf_ManWriteClauseIntoFile( pFile, pVarToPol, &Lit, &Lit + 1 );
+    }
+    fprintf( pFile, "\n" );
+    fclose( pFile );
+    Vec_IntFree( vSopTemp );
+    Vec_IntFree( vLits );
+    ABC_FREE( pClas );
+    ABC_FREE( pVarNums );
+    ABC_FREE( pVarToPol );
+    if ( pnVars )     *pnVars     = Number;
+    if ( pnClauses )  *pnClauses  = nClauses;
+    if ( pnLiterals ) *pnLiterals = nLiterals;
+    return 1;
+}
+
 
 /**Function*************************************************************
 
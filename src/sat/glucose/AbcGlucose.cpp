@@ -218,6 +218,13 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::SimpSolver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pman, void(*pexport)(void*, int*, int, int), int*(*pimport)(void*, int*, int*))
+{
+    ((Gluco::SimpSolver*)s)->pShareMan    = pman;
+    ((Gluco::SimpSolver*)s)->pShareExport = pexport;
+    ((Gluco::SimpSolver*)s)->pShareImport = pimport;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::SimpSolver*)s)->nRuntimeLimit;
@@ -480,6 +487,13 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::Solver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pman, void(*pexport)(void*, int*, int, int), int*(*pimport)(void*, int*, int*))
+{
+    ((Gluco::Solver*)s)->pShareMan    = pman;
+    ((Gluco::Solver*)s)->pShareExport = pexport;
+    ((Gluco::Solver*)s)->pShareImport = pimport;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::Solver*)s)->nRuntimeLimit;
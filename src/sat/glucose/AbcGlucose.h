@@ -85,6 +85,7 @@ extern void              bmcg_sat_solver_var_set_frozen( bmcg_sat_solver* s, int
 extern int               bmcg_sat_solver_elim_varnum(bmcg_sat_solver* s);
 extern int               bmcg_sat_solver_read_cex_varvalue( bmcg_sat_solver* s, int );
 extern void              bmcg_sat_solver_set_stop( bmcg_sat_solver* s, int * pstop );
+extern void              bmcg_sat_solver_set_share( bmcg_sat_solver* s, void * pman, void(*pexport)(void*, int*, int, int), int*(*pimport)(void*, int*, int*) );
 extern abctime           bmcg_sat_solver_set_runtime_limit( bmcg_sat_solver* s, abctime Limit );
 extern void              bmcg_sat_solver_set_conflict_budget( bmcg_sat_solver* s, int Limit );
 extern int               bmcg_sat_solver_varnum( bmcg_sat_solver* s );
@@ -97,6 +97,9 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , pShareMan(NULL)
+    , pShareExport(NULL)
+    , pShareImport(NULL)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1074,6 +1077,8 @@ lbool Solver::search(int nof_conflicts)
             learnt_clause.clear();
             selectors.clear();
             analyze(confl, learnt_clause, selectors,backtrack_level,nblevels,szWoutSelectors);
+            if (pShareExport && selectors.size() == 0)
+                pShareExport(pShareMan, (int *)&learnt_clause[0], learnt_clause.size(), nblevels);
 
             lbdQueue.push(nblevels);
             sumLBD += nblevels;
@@ -1169,6 +1174,43 @@ lbool Solver::search(int nof_conflicts)
 }
 
 
+// Adds the clauses exported by other solvers working on the same problem.
+// Returns false if one of them is falsified by the top-level assignment.
+bool Solver::importShared()
+{
+    vec<Lit> lits;
+    int * pLits, nLits, Lbd, i;
+    cancelUntil(0);
+    while ( (pLits = pShareImport(pShareMan, &nLits, &Lbd)) != NULL ){
+        lits.clear();
+        for (i = 0; i < nLits; i++){
+            Lit p = toLit(pLits[i]);
+            if (var(p) >= nVars() || value(p) == l_True)
+                break;
+            if (value(p) != l_False)
+                lits.push(p);
+        }
+        if (i < nLits)
+            continue;
+        if (lits.size() == 0)
+            return ok = false;
+        if (lits.size() == 1){
+            uncheckedEnqueue(lits[0]);
+            if (propagate() != CRef_Undef)
+                return ok = false;
+            continue;
+        }
+        CRef cr = ca.alloc(lits, true);
+        ca[cr].setLBD(Lbd < lits.size() ? Lbd : lits.size());
+        ca[cr].setSizeWithoutSelectors(lits.size());
+        learnts.push(cr);
+        attachClause(cr);
+        claBumpActivity(ca[cr]);
+    }
+    return true;
+}
+
+
 double Solver::progressEstimate() const
 {
     double  progress = 0;
@@ -1247,6 +1289,10 @@ printf("c ==================================[ Search Statistics (every %6d confl
     // Search:
     int curr_restarts = 0;
     while (status == l_Undef){
+      if (pShareImport && !importShared()){
+        status = l_False;
+        break;
+      }
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
         if (!withinBudget() || terminate_search_early || (pstop && *pstop)) break;
         if (nRuntimeLimit && Abc_Clock() > nRuntimeLimit)                   break;
@@ -61,6 +61,9 @@ public:
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
     uint64_t nRuntimeLimit;              // runtime limit
+    void * pShareMan;                    // external clause exchange
+    void(*pShareExport)(void * p, int * pLits, int nLits, int Lbd); // receives each learnt clause
+    int*(*pShareImport)(void * p, int * pnLits, int * pLbd);        // returns the next clause to add or NULL
     vec<int> user_vec;
     vec<Lit> user_lits;
 
@@ -303,6 +306,7 @@ protected:
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
+    bool     importShared     ();                                                      // Adds the clauses learnt by other solvers (at level 0).
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
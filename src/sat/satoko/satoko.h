@@ -138,6 +138,13 @@ extern int satoko_learntnum(satoko_t *);
 extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
+/* Clause sharing between solvers working on the same problem.
+ * - The export callback receives every learnt clause with its size and LBD.
+ * - The import callback is called at restarts until it returns NULL; each
+ *   call returns the next clause (and writes its size and LBD) to be added
+ *   as a learnt clause. Both solvers must use the same variable numbering.
+ */
+extern void satoko_set_share(satoko_t *, void *, void (*)(void *, int *, int, int), int * (*)(void *, int *, int *));
 extern void satoko_set_runid(satoko_t *, int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
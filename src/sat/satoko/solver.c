@@ -347,6 +347,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 
     vec_uint_clear(s->temp_lits);
     solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
+    if (s->pShareExport)
+        s->pShareExport(s->pShareMan, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
     s->sum_lbd += lbd;
     b_queue_push(s->bq_lbd, lbd);
     solver_cancel_until(s, bt_level);
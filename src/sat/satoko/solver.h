@@ -106,6 +106,11 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callbacks to exchange learnt clauses with other solvers */
+    void   *pShareMan;
+    void  (*pShareExport)(void *, int *, int, int);
+    int  *(*pShareImport)(void *, int *, int *);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -43,6 +43,45 @@ static inline int clause_is_satisfied(solver_t *s, struct clause *clause)
     return SATOKO_ERR;
 }
 
+/* Adds the clauses learnt by other solvers at level 0. Returns SATOKO_UNSAT
+ * if one of them is falsified by the top-level assignment. */
+static inline int solver_import_shared(solver_t *s)
+{
+    unsigned i, lit, cref;
+    int *lits, size, lbd;
+
+    solver_cancel_until(s, 0);
+    while ((lits = s->pShareImport(s->pShareMan, &size, &lbd)) != NULL) {
+        vec_uint_clear(s->temp_lits);
+        for (i = 0; i < (unsigned)size; i++) {
+            lit = (unsigned)lits[i];
+            if (lit2var(lit) >= vec_char_size(s->assigns) || lit_value(s, lit) == SATOKO_LIT_TRUE)
+                break;
+            if (lit_value(s, lit) != SATOKO_LIT_FALSE)
+                vec_uint_push_back(s->temp_lits, lit);
+        }
+        if (i < (unsigned)size)
+            continue;
+        if (vec_uint_size(s->temp_lits) == 0) {
+            s->status = SATOKO_ERR;
+            return SATOKO_UNSAT;
+        }
+        if (vec_uint_size(s->temp_lits) == 1) {
+            solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+            if (solver_propagate(s) != UNDEF) {
+                s->status = SATOKO_ERR;
+                return SATOKO_UNSAT;
+            }
+            continue;
+        }
+        cref = solver_clause_create(s, s->temp_lits, 1);
+        if ((unsigned)lbd < clause_fetch(s, cref)->lbd)
+            clause_fetch(s, cref)->lbd = lbd;
+        clause_watch(s, cref);
+    }
+    return SATOKO_UNDEC;
+}
+
 static inline void solver_clean_stats(solver_t *s)
 {
     long n_conflicts_all = s->stats.n_conflicts_all;
@@ -329,6 +368,8 @@ int satoko_solve(solver_t *s)
             return SATOKO_UNDEC;
 
     while (status == SATOKO_UNDEC) {
+        if (s->pShareImport && (status = solver_import_shared(s)) != SATOKO_UNDEC)
+            break;
         status = solver_search(s);
         if (solver_check_limits(s) == 0 || solver_stop(s))
             break;
@@ -647,6 +688,13 @@ void satoko_set_stop(satoko_t *s, int * pstop)
     s->pstop = pstop;
 }
 
+void satoko_set_share(satoko_t *s, void * pman, void (*pexport)(void *, int *, int, int), int * (*pimport)(void *, int *, int *))
+{
+    s->pShareMan = pman;
+    s->pShareExport = pexport;
+    s->pShareImport = pimport;
+}
+
 void satoko_set_stop_func(satoko_t *s, int (*fnct)(int))
 {
     s->pFuncStop = fnct;